@@ -16,4 +16,11 @@
 #include "../src/instance.hpp"
 #include "../src/monitor.hpp"
 #include "../src/window.hpp"
-#include "../src/device.hpp"
\ No newline at end of file
+#include "../src/device.hpp"
+#include "../src/atlas.hpp"
+#include "../src/image_cache.hpp"
+#include "../src/file_view.hpp"
+#include "../src/archive.hpp"
+#include "../src/memory_allocator.hpp"
+#include "../src/upload_batch.hpp"
+#include "../src/queue.hpp"
\ No newline at end of file
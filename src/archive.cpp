@@ -0,0 +1,261 @@
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+// Local includes
+#include "gvw.ipp"
+#include "archive.hpp"
+#include "file_view.hpp"
+
+namespace gvw {
+
+archive::archive(file_view_ptr View)
+    : view(std::move(View))
+{
+    auto isWithinView = [this](uint64_t Offset, uint64_t Size) {
+        return Offset <= this->view->GetSize() &&
+               Size <= this->view->GetSize() - Offset;
+    };
+
+    internal::archive_header header = {};
+    if (this->view->GetSize() < sizeof(header)) {
+        ErrorCallback("Archive is too small to contain a header.");
+        this->view = nullptr;
+        return;
+    }
+    std::memcpy(&header, this->view->GetData(), sizeof(header));
+    if (header.magic != internal::archive_header::MAGIC) {
+        ErrorCallback("File is not a GVW archive.");
+        this->view = nullptr;
+        return;
+    }
+    if (header.version != internal::archive_header::VERSION) {
+        ErrorCallback(("Unsupported archive version " +
+                       std::to_string(header.version) + ".")
+                          .c_str());
+        this->view = nullptr;
+        return;
+    }
+
+    uint64_t indexSize = static_cast<uint64_t>(header.entryCount) *
+                         sizeof(internal::archive_index_entry);
+    if (!isWithinView(sizeof(header), indexSize)) {
+        ErrorCallback("Archive index is out of bounds.");
+        this->view = nullptr;
+        return;
+    }
+    this->index = {
+        reinterpret_cast<const internal::archive_index_entry*>( // NOLINT
+            this->view->GetData() + sizeof(header)),            // NOLINT
+        header.entryCount
+    };
+
+    // Validate the whole index once so that lookups need no bounds checks.
+    for (size_t i = 0; i < this->index.size(); ++i) {
+        const internal::archive_index_entry& entry = this->index[i];
+        if (!isWithinView(entry.nameOffset, entry.nameSize) ||
+            !isWithinView(entry.dataOffset, entry.dataSize)) {
+            ErrorCallback("Archive entry is out of bounds.");
+            this->view = nullptr;
+            this->index = {};
+            return;
+        }
+        if (i > 0 &&
+            this->GetName(this->index[i - 1]) >= this->GetName(entry)) {
+            ErrorCallback("Archive index is not sorted.");
+            this->view = nullptr;
+            this->index = {};
+            return;
+        }
+    }
+}
+
+std::string_view archive::GetName(
+    const internal::archive_index_entry& Entry) const
+{
+    return { reinterpret_cast<const char*>( // NOLINT
+                 this->view->GetData() + Entry.nameOffset), // NOLINT
+             Entry.nameSize };
+}
+
+const internal::archive_index_entry* archive::FindEntry(
+    std::string_view Name) const
+{
+    auto entry = std::lower_bound(
+        this->index.begin(),
+        this->index.end(),
+        Name,
+        [this](const internal::archive_index_entry& Entry,
+               std::string_view Value) {
+            return this->GetName(Entry) < Value;
+        });
+    if (entry == this->index.end() || this->GetName(*entry) != Name) {
+        return nullptr;
+    }
+    return &*entry;
+}
+
+file_view_ptr archive::Find(const char* Name) const
+{
+    const internal::archive_index_entry* entry = this->FindEntry(Name);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    return this->view->Slice(entry->dataOffset, entry->dataSize);
+}
+
+std::optional<uint64_t> archive::GetHash(const char* Name) const
+{
+    const internal::archive_index_entry* entry = this->FindEntry(Name);
+    if (entry == nullptr) {
+        return std::nullopt;
+    }
+    return entry->dataHash;
+}
+
+std::vector<std::string> archive::GetNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(this->index.size());
+    for (const auto& entry : this->index) {
+        names.emplace_back(this->GetName(entry));
+    }
+    return names;
+}
+
+archive_ptr OpenArchive(const char* Path)
+{
+    // Archives are never read from other archives.
+    file_view_ptr view = internal::MapFileFromFileSystem(Path);
+    if (view == nullptr) {
+        return nullptr;
+    }
+    archive_ptr openedArchive =
+        std::make_shared<internal::archive_public_constructor>(view);
+    if (openedArchive->view == nullptr) {
+        return nullptr;
+    }
+    return openedArchive;
+}
+
+bool WriteArchive(const char* Path,
+                  const archive_write_info& Archive_Write_Info)
+{
+    uint32_t alignment = Archive_Write_Info.alignment;
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        ErrorCallback("Archive alignment must be a power of two.");
+        return false;
+    }
+
+    std::vector<archive_file_info> files = Archive_Write_Info.files;
+    std::sort(
+        files.begin(),
+        files.end(),
+        [](const archive_file_info& Left, const archive_file_info& Right) {
+            return Left.name < Right.name;
+        });
+    for (size_t i = 1; i < files.size(); ++i) {
+        if (files[i - 1].name == files[i].name) {
+            ErrorCallback(("Archive contains the name \"" + files[i].name +
+                           "\" more than once.")
+                              .c_str());
+            return false;
+        }
+    }
+
+    std::vector<file_view_ptr> views;
+    views.reserve(files.size());
+    for (const auto& file : files) {
+        file_view_ptr fileView =
+            internal::MapFileFromFileSystem(file.path.c_str());
+        if (fileView == nullptr) {
+            return false;
+        }
+        views.emplace_back(std::move(fileView));
+    }
+
+    // Lay out the index, the names, and then the aligned files.
+    internal::archive_header header = {
+        .magic = internal::archive_header::MAGIC,
+        .version = internal::archive_header::VERSION,
+        .entryCount = static_cast<uint32_t>(files.size()),
+        .alignment = alignment
+    };
+    std::vector<internal::archive_index_entry> index(files.size());
+    uint64_t offset =
+        sizeof(header) + (index.size() * sizeof(internal::archive_index_entry));
+    for (size_t i = 0; i < files.size(); ++i) {
+        index[i].nameOffset = offset;
+        index[i].nameSize = files[i].name.size();
+        offset += files[i].name.size();
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        offset = (offset + alignment - 1) &
+                 ~static_cast<uint64_t>(alignment - 1);
+        index[i].dataOffset = offset;
+        index[i].dataSize = views[i]->GetSize();
+        index[i].dataHash =
+            internal::Fnv1a64(views[i]->GetData(), views[i]->GetSize());
+        offset += views[i]->GetSize();
+    }
+
+    std::ofstream output(Path, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        ErrorCallback(("Failed to open archive \"" +
+                       static_cast<std::string>(Path) + "\" for writing.")
+                          .c_str());
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(&header), // NOLINT
+                 sizeof(header));
+    output.write(reinterpret_cast<const char*>(index.data()), // NOLINT
+                 static_cast<std::streamsize>(
+                     index.size() * sizeof(internal::archive_index_entry)));
+    for (const auto& file : files) {
+        output.write(file.name.data(),
+                     static_cast<std::streamsize>(file.name.size()));
+    }
+    const std::vector<char> PADDING(alignment, 0);
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto position = static_cast<uint64_t>(output.tellp());
+        output.write(PADDING.data(),
+                     static_cast<std::streamsize>(index[i].dataOffset -
+                                                  position));
+        output.write(reinterpret_cast<const char*>( // NOLINT
+                         views[i]->GetData()),
+                     static_cast<std::streamsize>(views[i]->GetSize()));
+    }
+    output.close();
+    if (output.fail()) {
+        ErrorCallback(("Failed to write archive \"" +
+                       static_cast<std::string>(Path) + "\".")
+                          .c_str());
+        return false;
+    }
+    return true;
+}
+
+void MountArchive(const archive_ptr& Archive)
+{
+    if (Archive == nullptr) {
+        ErrorCallback("Cannot mount a null archive.");
+        return;
+    }
+    std::scoped_lock lock(internal::global::MOUNTED_ARCHIVES_MUTEX);
+    internal::global::MOUNTED_ARCHIVES.emplace_back(Archive);
+}
+
+void UnmountArchive(const archive_ptr& Archive)
+{
+    std::scoped_lock lock(internal::global::MOUNTED_ARCHIVES_MUTEX);
+    std::erase(internal::global::MOUNTED_ARCHIVES, Archive);
+}
+
+void UnmountArchives()
+{
+    std::scoped_lock lock(internal::global::MOUNTED_ARCHIVES_MUTEX);
+    internal::global::MOUNTED_ARCHIVES.clear();
+}
+
+} // namespace gvw
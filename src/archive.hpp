@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file archive.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Packed asset archives.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <span>
+#include <string>
+#include <string_view>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief A read-only archive of files mapped into memory with a single open.
+/// @remark The archive begins with a header, followed by an index sorted by
+/// name, the names, and finally the files themselves, each aligned to the
+/// alignment recorded in the header.
+class archive : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::archive_public_constructor;
+
+    friend archive_ptr OpenArchive(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Validates the header and index of a mapped archive.
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    archive(file_view_ptr View);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~archive() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    file_view_ptr view;
+
+    /// @brief The index within the mapping. Empty if the archive is invalid.
+    std::span<const internal::archive_index_entry> index;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the name of an index entry.
+    [[nodiscard]] std::string_view GetName(
+        const internal::archive_index_entry& Entry) const;
+
+    /// @brief Returns the index entry for a name, or nullptr if the archive
+    /// does not contain it.
+    [[nodiscard]] const internal::archive_index_entry* FindEntry(
+        std::string_view Name) const;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns a view of a file within the archive, or nullptr if the
+    /// archive does not contain it.
+    /// @remark The view keeps the archive mapping alive.
+    [[nodiscard]] file_view_ptr Find(const char* Name) const;
+
+    /// @brief Returns the FNV-1a hash of a file within the archive, or nothing
+    /// if the archive does not contain it.
+    [[nodiscard]] std::optional<uint64_t> GetHash(const char* Name) const;
+
+    /// @brief Returns the names of all files in the archive in sorted order.
+    [[nodiscard]] std::vector<std::string> GetNames() const;
+};
+
+} // namespace gvw
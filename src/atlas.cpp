@@ -0,0 +1,382 @@
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+// Local includes
+#include "gvw.ipp"
+#include "atlas.hpp"
+
+namespace gvw {
+
+/// @brief The number of color components per pixel in each atlas page.
+const int ATLAS_COLOR_COMPONENTS_PER_PIXEL = 4;
+
+atlas::atlas(const atlas_info& Atlas_Info)
+    : info(Atlas_Info)
+{
+    if (this->info.pageSize.width <= 0 || this->info.pageSize.height <= 0) {
+        ErrorCallback("Atlas pages must have a width and height greater than "
+                      "zero.");
+        return;
+    }
+    if (this->info.padding < 0) {
+        ErrorCallback("Atlas padding must not be negative.");
+        return;
+    }
+    if (this->info.maxPages == 0) {
+        ErrorCallback("Atlas must be allowed at least one page.");
+        return;
+    }
+}
+
+atlas::page atlas::CreatePage() const
+{
+    page newPage;
+    newPage.pixels.resize(static_cast<size_t>(this->info.pageSize.width) *
+                              static_cast<size_t>(this->info.pageSize.height) *
+                              ATLAS_COLOR_COMPONENTS_PER_PIXEL,
+                          0);
+    newPage.skyline.push_back({ 0, 0, this->info.pageSize.width });
+    return newPage;
+}
+
+bool atlas::FindPosition(const page& Page,
+                         area<int> Padded_Size,
+                         coordinate<int>& Position) const
+{
+    bool found = false;
+    int bestBottom = 0;
+    int bestWidth = 0;
+
+    for (size_t nodeIndex = 0; nodeIndex < Page.skyline.size(); ++nodeIndex) {
+        int x = Page.skyline[nodeIndex].x;
+        if (x + Padded_Size.width > this->info.pageSize.width) {
+            break;
+        }
+
+        // The image rests on the highest node beneath it.
+        int y = 0;
+        int remainingWidth = Padded_Size.width;
+        for (size_t spanIndex = nodeIndex; remainingWidth > 0;
+             ++spanIndex) {
+            y = std::max(y, Page.skyline[spanIndex].y);
+            remainingWidth -= Page.skyline[spanIndex].width;
+        }
+        if (y + Padded_Size.height > this->info.pageSize.height) {
+            continue;
+        }
+
+        int bottom = y + Padded_Size.height;
+        if (!found || bottom < bestBottom ||
+            (bottom == bestBottom &&
+             Page.skyline[nodeIndex].width < bestWidth)) {
+            found = true;
+            bestBottom = bottom;
+            bestWidth = Page.skyline[nodeIndex].width;
+            Position = { x, y };
+        }
+    }
+
+    return found;
+}
+
+void atlas::AddSkylineLevel(page& Page,
+                            coordinate<int> Position,
+                            area<int> Padded_Size)
+{
+    auto node = std::find_if(
+        Page.skyline.begin(),
+        Page.skyline.end(),
+        [&](const skyline_node& Node) { return Node.x == Position.x; });
+    node = Page.skyline.insert(
+        node,
+        { Position.x, Position.y + Padded_Size.height, Padded_Size.width });
+
+    // Shrink or remove the nodes now covered by the new level.
+    int right = Position.x + Padded_Size.width;
+    auto next = std::next(node);
+    while (next != Page.skyline.end() && next->x < right) {
+        int nextRight = next->x + next->width;
+        if (nextRight <= right) {
+            next = Page.skyline.erase(next);
+        } else {
+            next->width = nextRight - right;
+            next->x = right;
+            break;
+        }
+    }
+
+    // Merge neighboring nodes at the same height.
+    for (size_t nodeIndex = 0; nodeIndex + 1 < Page.skyline.size();) {
+        if (Page.skyline[nodeIndex].y == Page.skyline[nodeIndex + 1].y) {
+            Page.skyline[nodeIndex].width += Page.skyline[nodeIndex + 1].width;
+            Page.skyline.erase(Page.skyline.begin() +
+                               static_cast<std::ptrdiff_t>(nodeIndex) + 1);
+        } else {
+            ++nodeIndex;
+        }
+    }
+}
+
+bool atlas::Place(std::vector<page>& Pages,
+                  const image_ptr& Image,
+                  size_t Page_Limit,
+                  atlas_region& Region) const
+{
+    area<int> paddedSize = { Image->size.width + this->info.padding,
+                             Image->size.height + this->info.padding };
+
+    for (size_t pageIndex = 0;; ++pageIndex) {
+        if (pageIndex == Pages.size()) {
+            if (Pages.size() >= Page_Limit) {
+                return false;
+            }
+            Pages.push_back(this->CreatePage());
+        }
+
+        coordinate<int> position = { 0, 0 };
+        if (!this->FindPosition(Pages[pageIndex], paddedSize, position)) {
+            continue;
+        }
+        AddSkylineLevel(Pages[pageIndex], position, paddedSize);
+
+        auto pageWidth = static_cast<float>(this->info.pageSize.width);
+        auto pageHeight = static_cast<float>(this->info.pageSize.height);
+        Region.page = pageIndex;
+        Region.position = position;
+        Region.size = Image->size;
+        Region.uvMin = { static_cast<float>(position.x) / pageWidth,
+                         static_cast<float>(position.y) / pageHeight };
+        Region.uvMax = {
+            static_cast<float>(position.x + Image->size.width) / pageWidth,
+            static_cast<float>(position.y + Image->size.height) / pageHeight
+        };
+        return true;
+    }
+}
+
+void atlas::Blit(std::vector<page>& Pages,
+                 const image_ptr& Image,
+                 const atlas_region& Region) const
+{
+    auto rowSize = static_cast<size_t>(Region.size.width) *
+                   ATLAS_COLOR_COMPONENTS_PER_PIXEL;
+    auto pageRowSize = static_cast<size_t>(this->info.pageSize.width) *
+                       ATLAS_COLOR_COMPONENTS_PER_PIXEL;
+    uint8_t* destination =
+        Pages[Region.page].pixels.data() +
+        (static_cast<size_t>(Region.position.y) * pageRowSize) +
+        (static_cast<size_t>(Region.position.x) *
+         ATLAS_COLOR_COMPONENTS_PER_PIXEL);
+
+    for (int row = 0; row < Region.size.height; ++row) {
+        std::memcpy(destination + (static_cast<size_t>(row) * pageRowSize),
+                    Image->data + (static_cast<size_t>(row) * rowSize),
+                    rowSize);
+    }
+}
+
+size_t atlas::GetPaddedArea(const image_ptr& Image) const
+{
+    return static_cast<size_t>(Image->size.width + this->info.padding) *
+           static_cast<size_t>(Image->size.height + this->info.padding);
+}
+
+bool atlas::RepackLocked(const image_ptr& Pending_Image,
+                         atlas_entry Pending_Entry)
+{
+    std::vector<std::pair<atlas_entry, image_ptr>> images;
+    images.reserve(this->entries.size() + 1);
+    for (const auto& [id, existingEntry] : this->entries) {
+        images.emplace_back(id, existingEntry.image);
+    }
+    if (Pending_Image != nullptr) {
+        images.emplace_back(Pending_Entry, Pending_Image);
+    }
+
+    // Skyline packers waste the least space when given the tallest images
+    // first.
+    std::stable_sort(images.begin(),
+                     images.end(),
+                     [](const auto& Left, const auto& Right) {
+                         if (Left.second->size.height !=
+                             Right.second->size.height) {
+                             return Left.second->size.height >
+                                    Right.second->size.height;
+                         }
+                         return Left.second->size.width >
+                                Right.second->size.width;
+                     });
+
+    std::vector<page> newPages;
+    std::map<atlas_entry, entry> newEntries;
+    for (const auto& [id, packedImage] : images) {
+        atlas_region region;
+        if (!this->Place(
+                newPages, packedImage, this->info.maxPages, region)) {
+            return false;
+        }
+        newEntries[id] = { packedImage, region };
+    }
+    for (const auto& [id, packedEntry] : newEntries) {
+        this->Blit(newPages, packedEntry.image, packedEntry.region);
+    }
+
+    this->pages = std::move(newPages);
+    this->entries = std::move(newEntries);
+    this->usedArea = 0;
+    for (const auto& [id, packedEntry] : this->entries) {
+        this->usedArea += this->GetPaddedArea(packedEntry.image);
+    }
+    this->freedArea = 0;
+    ++this->revision;
+    return true;
+}
+
+std::optional<atlas_entry> atlas::Insert(const image_ptr& Image)
+{
+    if (Image == nullptr || Image->data == nullptr) {
+        ErrorCallback("Cannot insert an empty image into an atlas.");
+        return std::nullopt;
+    }
+    if (Image->dataColorComponentsPerPixel !=
+        ATLAS_COLOR_COMPONENTS_PER_PIXEL) {
+        std::string message =
+            "Atlas images must have " +
+            std::to_string(ATLAS_COLOR_COMPONENTS_PER_PIXEL) +
+            " color components per pixel but the image has " +
+            std::to_string(Image->dataColorComponentsPerPixel) + ".";
+        ErrorCallback(message.c_str());
+        return std::nullopt;
+    }
+    if (Image->size.width + this->info.padding > this->info.pageSize.width ||
+        Image->size.height + this->info.padding >
+            this->info.pageSize.height) {
+        ErrorCallback("Image is larger than an atlas page.");
+        return std::nullopt;
+    }
+
+    std::scoped_lock lock(this->atlasMutex);
+
+    atlas_entry id = this->nextEntry++;
+
+    // Only repack before opening a new page if enough space was freed to make
+    // repacking worthwhile.
+    size_t packedArea = this->usedArea + this->freedArea;
+    bool repackFirst =
+        this->freedArea > 0 &&
+        static_cast<float>(this->freedArea) >=
+            this->info.repackThreshold * static_cast<float>(packedArea);
+
+    size_t pageLimit = this->info.maxPages;
+    if (repackFirst) {
+        pageLimit = std::max<size_t>(this->pages.size(), 1);
+    }
+    atlas_region region;
+    bool placed = this->Place(this->pages, Image, pageLimit, region);
+
+    if (!placed && this->freedArea > 0) {
+        if (this->RepackLocked(Image, id)) {
+            return id;
+        }
+        if (repackFirst) {
+            placed =
+                this->Place(this->pages, Image, this->info.maxPages, region);
+        }
+    }
+    if (!placed) {
+        ErrorCallback("Atlas is full.");
+        return std::nullopt;
+    }
+
+    this->Blit(this->pages, Image, region);
+    this->entries[id] = { Image, region };
+    this->usedArea += this->GetPaddedArea(Image);
+    ++this->revision;
+    return id;
+}
+
+void atlas::Remove(atlas_entry Entry)
+{
+    std::scoped_lock lock(this->atlasMutex);
+
+    auto existingEntry = this->entries.find(Entry);
+    if (existingEntry == this->entries.end()) {
+        WarningCallback("Attempted to remove an image that is not in the "
+                        "atlas.");
+        return;
+    }
+
+    // Clear the pixels so that stale texels are never sampled.
+    const atlas_region& region = existingEntry->second.region;
+    auto pageRowSize = static_cast<size_t>(this->info.pageSize.width) *
+                       ATLAS_COLOR_COMPONENTS_PER_PIXEL;
+    uint8_t* destination =
+        this->pages[region.page].pixels.data() +
+        (static_cast<size_t>(region.position.y) * pageRowSize) +
+        (static_cast<size_t>(region.position.x) *
+         ATLAS_COLOR_COMPONENTS_PER_PIXEL);
+    for (int row = 0; row < region.size.height; ++row) {
+        std::memset(destination + (static_cast<size_t>(row) * pageRowSize),
+                    0,
+                    static_cast<size_t>(region.size.width) *
+                        ATLAS_COLOR_COMPONENTS_PER_PIXEL);
+    }
+
+    size_t paddedArea = this->GetPaddedArea(existingEntry->second.image);
+    this->usedArea -= paddedArea;
+    this->freedArea += paddedArea;
+    this->entries.erase(existingEntry);
+    ++this->revision;
+}
+
+std::optional<atlas_region> atlas::GetRegion(atlas_entry Entry) const
+{
+    std::scoped_lock lock(this->atlasMutex);
+    auto existingEntry = this->entries.find(Entry);
+    if (existingEntry == this->entries.end()) {
+        return std::nullopt;
+    }
+    return existingEntry->second.region;
+}
+
+bool atlas::Repack()
+{
+    std::scoped_lock lock(this->atlasMutex);
+    return this->RepackLocked(nullptr, 0);
+}
+
+size_t atlas::GetPageCount() const
+{
+    std::scoped_lock lock(this->atlasMutex);
+    return this->pages.size();
+}
+
+area<int> atlas::GetPageSize() const
+{
+    return this->info.pageSize;
+}
+
+std::span<const uint8_t> atlas::GetPage(size_t Page_Index) const
+{
+    std::scoped_lock lock(this->atlasMutex);
+    if (Page_Index >= this->pages.size()) {
+        ErrorCallback("Atlas page index is out of range.");
+        return {};
+    }
+    return this->pages[Page_Index].pixels;
+}
+
+size_t atlas::GetRevision() const
+{
+    std::scoped_lock lock(this->atlasMutex);
+    return this->revision;
+}
+
+atlas_ptr CreateAtlas(const atlas_info& Atlas_Info)
+{
+    return std::make_shared<internal::atlas_public_constructor>(Atlas_Info);
+}
+
+} // namespace gvw
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * @file atlas.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Packs many small images into a few large pages.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <map>
+#include <span>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief Packs images into RGBA pages using a skyline bottom-left packer.
+/// @remark Images can be inserted and removed at any time. Removed images leave
+/// holes that the skyline cannot reuse, so the atlas repacks itself when an
+/// insertion fails and enough space has been freed.
+class atlas : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::atlas_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Initializes the atlas object.
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    atlas(const atlas_info& Atlas_Info);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~atlas() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                            Private Types                             ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief A horizontal segment of the skyline. Everything below `y` within
+    /// [x, x + width) is occupied.
+    struct skyline_node
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    struct page
+    {
+        std::vector<uint8_t> pixels;
+        std::vector<skyline_node> skyline;
+    };
+
+    struct entry
+    {
+        image_ptr image;
+        atlas_region region;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    atlas_info info;
+
+    std::vector<page> pages;
+    std::map<atlas_entry, entry> entries;
+    atlas_entry nextEntry = 0;
+
+    /// @brief The padded area of all images currently in the atlas.
+    size_t usedArea = 0;
+
+    /// @brief The padded area of images removed since the last repack.
+    size_t freedArea = 0;
+
+    size_t revision = 0;
+
+    mutable std::mutex atlasMutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns a blank page.
+    [[nodiscard]] page CreatePage() const;
+
+    /// @brief Finds the lowest position on a page for a padded image size.
+    /// Returns false if the image does not fit.
+    [[nodiscard]] bool FindPosition(const page& Page,
+                                    area<int> Padded_Size,
+                                    coordinate<int>& Position) const;
+
+    /// @brief Raises the skyline of a page to cover a padded image.
+    static void AddSkylineLevel(page& Page,
+                                coordinate<int> Position,
+                                area<int> Padded_Size);
+
+    /// @brief Places an image on the first page that fits it, opening new pages
+    /// up to a limit. Returns false if no page fits the image.
+    [[nodiscard]] bool Place(std::vector<page>& Pages,
+                             const image_ptr& Image,
+                             size_t Page_Limit,
+                             atlas_region& Region) const;
+
+    /// @brief Copies the pixels of an image into its region of a page.
+    void Blit(std::vector<page>& Pages,
+              const image_ptr& Image,
+              const atlas_region& Region) const;
+
+    /// @brief Returns the padded area of an image.
+    [[nodiscard]] size_t GetPaddedArea(const image_ptr& Image) const;
+
+    /// @brief Packs all images from scratch, tallest first, optionally
+    /// including a pending image. The atlas is left unchanged on failure.
+    [[nodiscard]] bool RepackLocked(const image_ptr& Pending_Image,
+                                    atlas_entry Pending_Entry);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Inserts an image into the atlas. Returns nothing if the image
+    /// cannot be packed.
+    /// @remark Images must have 4 color components per pixel (RGBA).
+    [[nodiscard]] std::optional<atlas_entry> Insert(const image_ptr& Image);
+
+    /// @brief Removes an image from the atlas. Its space is reclaimed during
+    /// the next repack.
+    void Remove(atlas_entry Entry);
+
+    /// @brief Returns the location of an image within the atlas.
+    /// @remark Regions change when the atlas is repacked. Query them again
+    /// whenever the revision changes.
+    [[nodiscard]] std::optional<atlas_region> GetRegion(
+        atlas_entry Entry) const;
+
+    /// @brief Packs all images from scratch to reclaim the space left by
+    /// removed images. Returns false if the images no longer fit, in which case
+    /// the atlas is left unchanged.
+    [[nodiscard]] bool Repack();
+
+    /// @brief Returns the number of pages in use.
+    [[nodiscard]] size_t GetPageCount() const;
+
+    /// @brief Returns the size of each page in pixels.
+    [[nodiscard]] area<int> GetPageSize() const;
+
+    /// @brief Returns the RGBA pixels of a page.
+    /// @warning The returned span is invalidated by any call that modifies the
+    /// atlas.
+    [[nodiscard]] std::span<const uint8_t> GetPage(size_t Page_Index) const;
+
+    /// @brief Returns a counter that is incremented whenever the pixels of any
+    /// page or the region of any image changes.
+    [[nodiscard]] size_t GetRevision() const;
+};
+
+} // namespace gvw
@@ -1,4 +1,6 @@
 // Standard includes
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <stdexcept>
 
@@ -280,8 +282,9 @@ const instance_joystick_event_callback
     instance_joystick_event_callback_config::APPEND_TO_JOYSTICK_EVENT_BUFFER =
         (instance_joystick_event_callback)[](int JID, int Event)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    internal::global::JOYSTICK_EVENTS.emplace_back(JID, Event);
+    std::scoped_lock lock(internal::global::JOYSTICK_EVENTS_MUTEX);
+    internal::global::JOYSTICK_EVENTS.emplace_back(
+        JID, Event, std::chrono::steady_clock::now());
 };
 
 const instance_info instance_info_config::DEFAULT;
@@ -305,9 +308,9 @@ const window_key_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->keyEventsMutex);
-    windowPtr->keyEvents.emplace_back(
-        window_key(Key), Scancode, window_key_action(Action), Mods);
+    window_event event = { .type = window_event_type::eKey };
+    event.key = { window_key(Key), Scancode, window_key_action(Action), Mods };
+    windowPtr->PushEvent(event);
 };
 
 const window_character_event_callback
@@ -319,8 +322,9 @@ const window_character_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->characterEventsMutex);
-    windowPtr->characterEvents.emplace_back(Code_Point);
+    window_event event = { .type = window_event_type::eCharacter };
+    event.character = Code_Point;
+    windowPtr->PushEvent(event);
 };
 
 const window_cursor_position_event_callback
@@ -335,8 +339,9 @@ const window_cursor_position_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->cursorPositionEventsMutex);
-    windowPtr->cursorPositionEvents.emplace_back(X_Position, Y_Position);
+    window_event event = { .type = window_event_type::eCursorPosition };
+    event.cursorPosition = { X_Position, Y_Position };
+    windowPtr->PushEvent(event);
 };
 
 const window_cursor_enter_event_callback
@@ -349,8 +354,9 @@ const window_cursor_enter_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->cursorEnterEventsMutex);
-    windowPtr->cursorEnterEvents.emplace_back(Entered);
+    window_event event = { .type = window_event_type::eCursorEnter };
+    event.cursorEnter = Entered;
+    windowPtr->PushEvent(event);
 };
 
 const window_mouse_button_event_callback
@@ -365,8 +371,9 @@ const window_mouse_button_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->mouseButtonEventsMutex);
-    windowPtr->mouseButtonEvents.emplace_back(Button, Action, Mods);
+    window_event event = { .type = window_event_type::eMouseButton };
+    event.mouseButton = { Button, Action, Mods };
+    windowPtr->PushEvent(event);
 };
 
 const window_scroll_event_callback window_scroll_event_callback_config::NONE =
@@ -379,8 +386,9 @@ const window_scroll_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->scrollEventsMutex);
-    windowPtr->scrollEvents.emplace_back(X_Offset, Y_Offset);
+    window_event event = { .type = window_event_type::eScroll };
+    event.scroll = { X_Offset, Y_Offset };
+    windowPtr->PushEvent(event);
 };
 
 const window_file_drop_event_callback
@@ -393,8 +401,9 @@ const window_file_drop_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->fileDropEventsMutex);
-    windowPtr->fileDropEvents.emplace_back(Count, Paths);
+    window_event event = { .type = window_event_type::eFileDrop };
+    event.fileDrop = { Count, Paths };
+    windowPtr->PushEvent(event);
 };
 
 const window_close_event_callback window_close_event_callback_config::NONE =
@@ -405,8 +414,7 @@ const window_close_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->closeEventsMutex);
-    windowPtr->closeEvents++;
+    windowPtr->PushEvent({ .type = window_event_type::eClose });
 };
 
 const window_size_event_callback window_size_event_callback_config::NONE =
@@ -419,8 +427,9 @@ const window_size_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->sizeEventsMutex);
-    windowPtr->sizeEvents.emplace_back(Width, Height);
+    window_event event = { .type = window_event_type::eSize };
+    event.size = { Width, Height };
+    windowPtr->PushEvent(event);
 };
 
 const window_framebuffer_size_event_callback
@@ -435,8 +444,9 @@ const window_framebuffer_size_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->framebufferSizeEventsMutex);
-    windowPtr->framebufferSizeEvents.emplace_back(Width, Height);
+    window_event event = { .type = window_event_type::eFramebufferSize };
+    event.framebufferSize = { Width, Height };
+    windowPtr->PushEvent(event);
 };
 
 const window_content_scale_event_callback
@@ -450,8 +460,9 @@ const window_content_scale_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->contentScaleEventsMutex);
-    windowPtr->contentScaleEvents.emplace_back(X_Scale, Y_Scale);
+    window_event event = { .type = window_event_type::eContentScale };
+    event.contentScale = { X_Scale, Y_Scale };
+    windowPtr->PushEvent(event);
 };
 
 const window_position_event_callback
@@ -464,8 +475,9 @@ const window_position_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->positionEventsMutex);
-    windowPtr->positionEvents.emplace_back(X_Position, Y_Position);
+    window_event event = { .type = window_event_type::ePosition };
+    event.position = { X_Position, Y_Position };
+    windowPtr->PushEvent(event);
 };
 
 const window_iconify_event_callback window_iconify_event_callback_config::NONE =
@@ -477,8 +489,9 @@ const window_iconify_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->iconifyEventsMutex);
-    windowPtr->iconifyEvents.emplace_back(Iconified);
+    window_event event = { .type = window_event_type::eIconify };
+    event.iconify = Iconified;
+    windowPtr->PushEvent(event);
 };
 
 const window_maximize_event_callback
@@ -490,8 +503,9 @@ const window_maximize_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->maximizeEventsMutex);
-    windowPtr->maximizeEvents.emplace_back(Maximized);
+    window_event event = { .type = window_event_type::eMaximize };
+    event.maximize = Maximized;
+    windowPtr->PushEvent(event);
 };
 
 const window_focus_event_callback window_focus_event_callback_config::NONE =
@@ -502,8 +516,9 @@ const window_focus_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->focusEventsMutex);
-    windowPtr->focusEvents.emplace_back(Focused);
+    window_event event = { .type = window_event_type::eFocus };
+    event.focus = Focused;
+    windowPtr->PushEvent(event);
 };
 
 const window_refresh_event_callback window_refresh_event_callback_config::NONE =
@@ -514,8 +529,7 @@ const window_refresh_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->refreshEventsMutex);
-    windowPtr->refreshEvents++;
+    windowPtr->PushEvent({ .type = window_event_type::eRefresh });
 };
 
 const window_event_callbacks window_event_callbacks_config::NONE;
@@ -556,6 +570,18 @@ const window_event_callbacks
             window_refresh_event_callback_config::APPEND_TO_REFRESH_EVENT_BUFFER
     };
 
+const window_event_coalescing_info
+    window_event_coalescing_info_config::KEEP_ALL;
+const window_event_coalescing_info
+    window_event_coalescing_info_config::BOUNDED = {
+        .cursorPosition = window_event_coalescing::eKeepLast,
+        .scroll = window_event_coalescing::eAccumulate,
+        .size = window_event_coalescing::eKeepLast,
+        .framebufferSize = window_event_coalescing::eKeepLast,
+        .contentScale = window_event_coalescing::eKeepLast,
+        .position = window_event_coalescing::eKeepLast
+    };
+
 const window_creation_hints_info window_creation_hints_info_config::DEFAULT;
 
 const window_creation_hints window_creation_hints_config::DEFAULT;
@@ -575,6 +601,12 @@ const window_size_limit window_size_limit_config::NO_MAXIMUM = {
 
 const window_info window_info_config::DEFAULT;
 
+/******************************    Image Cache    *****************************/
+const image_cache_info image_cache_info_config::DEFAULT;
+
+/*********************************    Atlas    ********************************/
+const atlas_info atlas_info_config::DEFAULT;
+
 /********************************    Cursor    ********************************/
 const cursor_hotspot cursor_hotspot_config::DEFAULT = { 0, 0 };
 
@@ -662,9 +694,7 @@ const device_selection_function
         const auto& presentModes = physicalDeviceInfo.presentModes;
 
         // Score different types of devices based on assumed performance.
-        vk::PhysicalDeviceProperties physicalDeviceProperties =
-            physicalDevice.getProperties();
-        switch (physicalDeviceProperties.deviceType) {
+        switch (physicalDeviceInfo.properties.deviceType) {
             case vk::PhysicalDeviceType::eDiscreteGpu:
                 currentPhysicalDeviceScore = 4;
                 break;
@@ -781,8 +811,8 @@ const device_selection_function
             }
         }
 
-        std::vector<vk::QueueFamilyProperties> queueFamilyProperties =
-            physicalDevice.getQueueFamilyProperties();
+        const auto& queueFamilyProperties =
+            physicalDeviceInfo.queueFamilyProperties;
         if (queueFamilyProperties.empty()) {
             continue;
         }
@@ -792,25 +822,27 @@ const device_selection_function
         std::optional<uint32_t> viablePresentationQueueFamilyIndex;
         for (uint32_t i = 0; i < uint32_t(queueFamilyProperties.size()); ++i) {
             vk::QueueFlags queueFlags = queueFamilyProperties.at(i).queueFlags;
-            if (viableGraphicsQueueFamilyIndex.has_value() == false) {
-                if (bool(queueFlags & vk::QueueFlagBits::eGraphics)) {
-                    viableGraphicsQueueFamilyIndex = i;
-                }
+            bool supportsGraphics =
+                bool(queueFlags & vk::QueueFlagBits::eGraphics);
+            bool supportsPresentation =
+                Window_Surface.has_value() &&
+                (physicalDevice.getSurfaceSupportKHR(
+                     i, Window_Surface.value()) != VK_FALSE);
+
+            // Prefer a single family for both so that swapchain images are
+            // never transferred between queue families.
+            if (supportsGraphics && supportsPresentation) {
+                viableGraphicsQueueFamilyIndex = i;
+                viablePresentationQueueFamilyIndex = i;
+                break;
             }
-            if (Window_Surface.has_value() &&
-                (viablePresentationQueueFamilyIndex.has_value() == false)) {
-                if (physicalDevice.getSurfaceSupportKHR(
-                        i, Window_Surface.value()) != VK_FALSE) {
-                    viablePresentationQueueFamilyIndex = i;
-                }
+            if (supportsGraphics &&
+                (viableGraphicsQueueFamilyIndex.has_value() == false)) {
+                viableGraphicsQueueFamilyIndex = i;
             }
-
-            if (viableGraphicsQueueFamilyIndex.has_value() &&
-                viablePresentationQueueFamilyIndex.has_value()) {
-                if (viableGraphicsQueueFamilyIndex.value() ==
-                    viablePresentationQueueFamilyIndex.value()) {
-                    break;
-                }
+            if (supportsPresentation &&
+                (viablePresentationQueueFamilyIndex.has_value() == false)) {
+                viablePresentationQueueFamilyIndex = i;
             }
         }
         if ((viableGraphicsQueueFamilyIndex.has_value() == false) ||
@@ -861,6 +893,28 @@ const device_selection_function
                           .presentMode = selectedPresentMode,
                           .queueFamilyInfos = selectedQueueFamilyInfos } };
 };
+const device_selection_function
+    device_selection_function_config::MULTIPLE_QUEUES =
+        (device_selection_function)[]( // NOLINT
+            const std::vector<device_selection_parameter>&
+                Physical_Device_Infos,
+            const std::optional<vk::SurfaceKHR>& Window_Surface)
+            ->std::vector<device_info>
+{
+    std::vector<device_info> selectedDevices =
+        device_selection_function_config::MINIMUM_FOR_PRESENTATION(
+            Physical_Device_Infos, Window_Surface);
+    for (auto& selectedDevice : selectedDevices) {
+        for (auto& queueFamilyInfo : selectedDevice.queueFamilyInfos) {
+            queueFamilyInfo.createInfo.queueCount = std::min(
+                queueFamilyInfo.properties.queueCount,
+                uint32_t(device_queue_priorities_config::DESCENDING.size()));
+            queueFamilyInfo.createInfo.pQueuePriorities =
+                device_queue_priorities_config::DESCENDING.data();
+        }
+    }
+    return selectedDevices;
+};
 
 const device_features device_features_config::NONE;
 
@@ -871,6 +925,10 @@ const device_extensions device_extensions_config::SWAPCHAIN = {
 
 const device_queue_priority device_queue_priority_config::HIGH = 1.0F;
 
+const device_queue_priorities device_queue_priorities_config::DESCENDING = {
+    1.0F, 0.75F, 0.5F, 0.25F // NOLINT
+};
+
 const device_info device_info_config::DEFAULT;
 
 const device_selection_info device_selection_info_config::DEFAULT;
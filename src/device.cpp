@@ -1,12 +1,22 @@
 // Standard includes
 #include <iostream>
 #include <fstream>
+#include <cstring>
+#include <filesystem>
+#include <chrono>
+#include <future>
+#include <bit>
+#include <string_view>
 
 // Local includes
 #include "gvw.ipp"
 #include "instance.hpp"
 #include "window.hpp"
 #include "device.hpp"
+#include "file_view.hpp"
+#include "memory_allocator.hpp"
+#include "upload_batch.hpp"
+#include "queue.hpp"
 #include "impl.hpp"
 
 namespace gvw {
@@ -17,6 +27,10 @@ device::device(const device_info& Device_Info)
     , surfaceFormat(Device_Info.surfaceFormat)
     , presentMode(Device_Info.presentMode)
     , queueFamilyInfos(Device_Info.queueFamilyInfos)
+    , memoryBudgetWarningThreshold(Device_Info.memoryBudgetWarningThreshold)
+    , pipelineCachePath(Device_Info.pipelineCachePath == nullptr
+                            ? ""
+                            : Device_Info.pipelineCachePath)
 {
     /// @todo GVW could be destroyed and then reinitialized between the
     /// initialization of gvwInstance and this line below. Resolve this by
@@ -37,6 +51,44 @@ device::device(const device_info& Device_Info)
         return;
     }
 
+    this->properties = this->physicalDevice.getProperties();
+    this->features = this->physicalDevice.getFeatures();
+    this->memoryProperties = this->physicalDevice.getMemoryProperties();
+    this->queueFamilyProperties =
+        this->physicalDevice.getQueueFamilyProperties();
+
+    // Enable memory budget queries if the device supports them. Budgets are
+    // queried with vkGetPhysicalDeviceMemoryProperties2, which requires both
+    // the instance and the device to support Vulkan 1.1.
+    device_extensions logicalDeviceExtensions =
+        Device_Info.logicalDeviceExtensions;
+    if (this->gvwInstance->pImpl->vulkanApiVersion >= VK_API_VERSION_1_1 &&
+        this->properties.apiVersion >= VK_API_VERSION_1_1) {
+        std::vector<vk::ExtensionProperties> availableExtensions =
+            this->physicalDevice.enumerateDeviceExtensionProperties();
+        auto isMemoryBudget = [](std::string_view Extension_Name) {
+            return Extension_Name == VK_EXT_MEMORY_BUDGET_EXTENSION_NAME;
+        };
+        this->memoryBudgetSupported = std::any_of(
+            availableExtensions.begin(),
+            availableExtensions.end(),
+            [&](const vk::ExtensionProperties& Extension) {
+                return isMemoryBudget(Extension.extensionName.data());
+            });
+        if (this->memoryBudgetSupported &&
+            std::none_of(logicalDeviceExtensions.begin(),
+                         logicalDeviceExtensions.end(),
+                         isMemoryBudget)) {
+            logicalDeviceExtensions.push_back(
+                VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+    }
+    this->enabledExtensions.assign(logicalDeviceExtensions.begin(),
+                                   logicalDeviceExtensions.end());
+    this->enabledFeatures = Device_Info.physicalDeviceFeatures;
+    this->heapsOverBudgetThreshold.resize(
+        this->memoryProperties.memoryHeapCount);
+
     /// @todo Get queue create infos out of selection::queue_family_info
     /// without copying the data here.
     std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
@@ -57,11 +109,91 @@ device::device(const device_info& Device_Info)
         .ppEnabledLayerNames =
             this->gvwInstance->pImpl->vulkanInstanceLayers.data(),
         .enabledExtensionCount =
-            static_cast<uint32_t>(Device_Info.logicalDeviceExtensions.size()),
-        .ppEnabledExtensionNames = Device_Info.logicalDeviceExtensions.data(),
+            static_cast<uint32_t>(logicalDeviceExtensions.size()),
+        .ppEnabledExtensionNames = logicalDeviceExtensions.data(),
         .pEnabledFeatures = &Device_Info.physicalDeviceFeatures
     };
     this->handle = physicalDevice.createDeviceUnique(logicalDeviceCreateInfo);
+
+    for (const auto& queueCreateInfo : queueCreateInfos) {
+        for (uint32_t i = 0; i < queueCreateInfo.queueCount; ++i) {
+            this->queues.emplace(
+                std::pair{ queueCreateInfo.queueFamilyIndex, i },
+                std::make_shared<internal::queue_public_constructor>(
+                    this->handle->getQueue(queueCreateInfo.queueFamilyIndex, i),
+                    queueCreateInfo.queueFamilyIndex,
+                    i));
+        }
+    }
+
+    this->memoryAllocator =
+        std::make_shared<internal::memory_allocator_public_constructor>(
+            this->handle.get(), this->memoryProperties);
+
+    // Seed the pipeline cache with pipelines compiled during previous runs.
+    std::vector<char> pipelineCacheData = this->LoadPipelineCacheData();
+    vk::PipelineCacheCreateInfo pipelineCacheCreateInfo = {
+        .initialDataSize = pipelineCacheData.size(),
+        .pInitialData = pipelineCacheData.data()
+    };
+    this->pipelineCache =
+        this->handle->createPipelineCacheUnique(pipelineCacheCreateInfo);
+}
+
+device::~device()
+{
+    // Worker threads may still be compiling pipelines with this device.
+    this->WaitForPipelines();
+
+    if (this->pipelineCachePath.empty() || !this->pipelineCache) {
+        return;
+    }
+    try {
+        static_cast<void>(this->SavePipelineCache());
+    } catch (...) { // NOLINT
+        // Destructors must not throw. The error has already been reported.
+    }
+}
+
+std::vector<char> device::LoadPipelineCacheData() const
+{
+    if (this->pipelineCachePath.empty()) {
+        return {};
+    }
+    std::ifstream file(this->pipelineCachePath,
+                       std::ios::ate | std::ios::binary);
+    if (!file.is_open()) {
+        // The pipeline cache has not been saved yet.
+        return {};
+    }
+    std::vector<char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(data.data(), static_cast<std::streamsize>(data.size()));
+    if (file.fail()) {
+        return {};
+    }
+
+    // Pipeline caches are only valid for the driver and physical device that
+    // created them.
+    VkPipelineCacheHeaderVersionOne header = {};
+    if (data.size() < sizeof(header)) {
+        return {};
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.headerSize < sizeof(header) ||
+        header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        header.vendorID != this->properties.vendorID ||
+        header.deviceID != this->properties.deviceID ||
+        std::memcmp(header.pipelineCacheUUID,
+                    this->properties.pipelineCacheUUID.data(),
+                    VK_UUID_SIZE) != 0) {
+        InfoCallback(("Discarding pipeline cache \"" +
+                      this->pipelineCachePath +
+                      "\" created by a different device or driver.")
+                         .c_str());
+        return {};
+    }
+    return data;
 }
 
 vk::Device device::GetHandle() const
@@ -90,52 +222,361 @@ std::vector<device_selection_queue_family_info> device::GetQueueFamilyInfos()
     return this->queueFamilyInfos;
 }
 
-shader_ptr device::LoadShaderFromSpirVFile(const shader_info& Shader_Info)
+uint32_t device::GetNextQueueIndex(uint32_t Queue_Family_Index)
+{
+    auto queueFamilyInfo = std::find_if(
+        this->queueFamilyInfos.begin(),
+        this->queueFamilyInfos.end(),
+        [&](const device_selection_queue_family_info& Queue_Family_Info) {
+            return Queue_Family_Info.createInfo.queueFamilyIndex ==
+                   Queue_Family_Index;
+        });
+    if (queueFamilyInfo == this->queueFamilyInfos.end() ||
+        queueFamilyInfo->createInfo.queueCount == 0) {
+        ErrorCallback("No queues were created for the queue family.");
+        return 0;
+    }
+
+    std::scoped_lock lock(this->nextQueueIndicesMutex);
+    uint32_t& nextQueueIndex = this->nextQueueIndices[Queue_Family_Index];
+    uint32_t queueIndex = nextQueueIndex;
+    nextQueueIndex =
+        (nextQueueIndex + 1) % queueFamilyInfo->createInfo.queueCount;
+    return queueIndex;
+}
+
+queue_ptr device::GetQueue(uint32_t Queue_Family_Index, uint32_t Queue_Index)
+{
+    auto deviceQueue =
+        this->queues.find(std::pair{ Queue_Family_Index, Queue_Index });
+    if (deviceQueue == this->queues.end()) {
+        ErrorCallback("The queue was not created with the logical device.");
+        return nullptr;
+    }
+    return deviceQueue->second;
+}
+
+queue_ptr device::AcquireQueue(uint32_t Queue_Family_Index)
+{
+    return this->GetQueue(Queue_Family_Index,
+                          this->GetNextQueueIndex(Queue_Family_Index));
+}
+
+void device::WaitIdle()
+{
+    for (const auto& [queueIndices, deviceQueue] : this->queues) {
+        deviceQueue->WaitIdle();
+    }
+}
+
+const vk::PhysicalDeviceProperties& device::GetProperties() const
+{
+    return this->properties;
+}
+
+const vk::PhysicalDeviceLimits& device::GetLimits() const
+{
+    return this->properties.limits;
+}
+
+const vk::PhysicalDeviceFeatures& device::GetFeatures() const
+{
+    return this->features;
+}
+
+const vk::PhysicalDeviceMemoryProperties& device::GetMemoryProperties() const
+{
+    return this->memoryProperties;
+}
+
+const std::vector<vk::QueueFamilyProperties>& device::GetQueueFamilyProperties()
+    const
+{
+    return this->queueFamilyProperties;
+}
+
+bool device::IsCompatible(const device_selection_info& Device_Selection_Info,
+                          vk::SurfaceKHR Surface) const
+{
+    if (!this->handle) {
+        return false;
+    }
+
+    for (const char* extension :
+         Device_Selection_Info.logicalDeviceExtensions) {
+        if (std::find(this->enabledExtensions.begin(),
+                      this->enabledExtensions.end(),
+                      extension) == this->enabledExtensions.end()) {
+            return false;
+        }
+    }
+
+    // vk::PhysicalDeviceFeatures is a sequence of VkBool32 members.
+    constexpr size_t FEATURE_COUNT =
+        sizeof(vk::PhysicalDeviceFeatures) / sizeof(vk::Bool32);
+    const auto* selectedFeatures =
+        reinterpret_cast<const vk::Bool32*>( // NOLINT
+            &Device_Selection_Info.physicalDeviceFeatures);
+    const auto* deviceFeatures =
+        reinterpret_cast<const vk::Bool32*>( // NOLINT
+            &this->enabledFeatures);
+    for (size_t i = 0; i < FEATURE_COUNT; ++i) {
+        if (selectedFeatures[i] != VK_FALSE && // NOLINT
+            deviceFeatures[i] == VK_FALSE) {   // NOLINT
+            return false;
+        }
+    }
+
+    const swapchain_surface_formats& selectedSurfaceFormats =
+        Device_Selection_Info.surfaceFormats;
+    if (std::find(selectedSurfaceFormats.begin(),
+                  selectedSurfaceFormats.end(),
+                  this->surfaceFormat) == selectedSurfaceFormats.end()) {
+        return false;
+    }
+    const swapchain_present_modes& selectedPresentModes =
+        Device_Selection_Info.presentModes;
+    if (std::find(selectedPresentModes.begin(),
+                  selectedPresentModes.end(),
+                  this->presentMode) == selectedPresentModes.end()) {
+        return false;
+    }
+
+    std::vector<vk::SurfaceFormatKHR> availableSurfaceFormats =
+        this->physicalDevice.getSurfaceFormatsKHR(Surface);
+    if (std::find(availableSurfaceFormats.begin(),
+                  availableSurfaceFormats.end(),
+                  this->surfaceFormat) == availableSurfaceFormats.end()) {
+        return false;
+    }
+    std::vector<vk::PresentModeKHR> availablePresentModes =
+        this->physicalDevice.getSurfacePresentModesKHR(Surface);
+    if (std::find(availablePresentModes.begin(),
+                  availablePresentModes.end(),
+                  this->presentMode) == availablePresentModes.end()) {
+        return false;
+    }
+
+    return std::any_of(
+        this->queueFamilyInfos.begin(),
+        this->queueFamilyInfos.end(),
+        [&](const device_selection_queue_family_info& Queue_Family_Info) {
+            return this->physicalDevice.getSurfaceSupportKHR(
+                       Queue_Family_Info.createInfo.queueFamilyIndex,
+                       Surface) != VK_FALSE;
+        });
+}
+
+const std::vector<uint32_t>& device::FindMemoryTypes(
+    uint32_t Memory_Type_Bits,
+    vk::MemoryPropertyFlags Memory_Properties)
 {
-    auto charBuffer = ReadFile(Shader_Info.code);
+    uint64_t key = (static_cast<uint64_t>(Memory_Type_Bits) << 32U) |
+                   static_cast<VkMemoryPropertyFlags>(Memory_Properties);
+
+    std::scoped_lock lock(this->objectCacheMutex);
+    auto [memoryTypes, inserted] = this->memoryTypeCache.try_emplace(key);
+    if (!inserted) {
+        return memoryTypes->second;
+    }
+
+    struct ranked_memory_type
+    {
+        uint32_t index;
+        int unrequestedPropertyCount;
+        vk::DeviceSize heapSize;
+    };
+    std::vector<ranked_memory_type> rankedMemoryTypes;
+    for (uint32_t i = 0; i < this->memoryProperties.memoryTypeCount; ++i) {
+        vk::MemoryPropertyFlags propertyFlags =
+            this->memoryProperties.memoryTypes.at(i).propertyFlags;
+        if ((Memory_Type_Bits & (1U << i)) == 0U ||
+            (propertyFlags & Memory_Properties) != Memory_Properties) {
+            continue;
+        }
+        rankedMemoryTypes.push_back(
+            { .index = i,
+              .unrequestedPropertyCount = std::popcount(
+                  static_cast<VkMemoryPropertyFlags>(propertyFlags &
+                                                     ~Memory_Properties)),
+              .heapSize = this->memoryProperties.memoryHeaps
+                              .at(this->memoryProperties.memoryTypes.at(i)
+                                      .heapIndex)
+                              .size });
+    }
+    std::stable_sort(
+        rankedMemoryTypes.begin(),
+        rankedMemoryTypes.end(),
+        [](const ranked_memory_type& Lhs, const ranked_memory_type& Rhs) {
+            if (Lhs.unrequestedPropertyCount != Rhs.unrequestedPropertyCount) {
+                return Lhs.unrequestedPropertyCount <
+                       Rhs.unrequestedPropertyCount;
+            }
+            return Lhs.heapSize > Rhs.heapSize;
+        });
+
+    memoryTypes->second.reserve(rankedMemoryTypes.size());
+    for (const auto& rankedMemoryType : rankedMemoryTypes) {
+        memoryTypes->second.push_back(rankedMemoryType.index);
+    }
+    return memoryTypes->second;
+}
+
+file_view_ptr device::MapShaderCode(const shader_info& Shader_Info)
+{
+    file_view_ptr view = Shader_Info.view;
+    if (view == nullptr) {
+        view = MapFile(Shader_Info.code);
+        if (view == nullptr) {
+            return nullptr;
+        }
+    }
+    if (view->GetSize() == 0) {
+        ErrorCallback("SPIR-V code must not be empty.");
+        return nullptr;
+    }
+    if (view->GetSize() % sizeof(uint32_t) != 0) {
+        ErrorCallback("SPIR-V code size must be a multiple of 4 bytes.");
+        return nullptr;
+    }
+    return view;
+}
+
+vk::UniqueShaderModule device::CreateShaderModule(const file_view_ptr& Code)
+{
+    // Mappings are page aligned but slices of them might not be aligned to
+    // the 4 bytes required by Vulkan.
+    const auto* code =
+        reinterpret_cast<const uint32_t*>(Code->GetData()); // NOLINT
+    std::vector<uint32_t> alignedCode;
+    if (reinterpret_cast<uintptr_t>(code) % alignof(uint32_t) != 0) { // NOLINT
+        alignedCode.resize(Code->GetSize() / sizeof(uint32_t));
+        std::memcpy(alignedCode.data(), Code->GetData(), Code->GetSize());
+        code = alignedCode.data();
+    }
 
     vk::ShaderModuleCreateInfo shaderModuleCreateInfo = {
-        .codeSize = charBuffer.size(),
-        .pCode = reinterpret_cast<const uint32_t*>(charBuffer.data()) // NOLINT
+        .codeSize = Code->GetSize(),
+        .pCode = code
     };
-    return std::make_shared<internal::shader_public_constructor>(
-        this->handle->createShaderModuleUnique(shaderModuleCreateInfo),
-        Shader_Info.stage,
-        Shader_Info.entryPoint);
+    return this->handle->createShaderModuleUnique(shaderModuleCreateInfo);
+}
+
+device::shader_cache_key device::GetShaderCacheKey(
+    const shader_info& Shader_Info,
+    const file_view_ptr& Code,
+    uint64_t Layout_Hash)
+{
+    return { .codeHash = internal::Fnv1a64(Code->GetData(), Code->GetSize()),
+             .codeSize = Code->GetSize(),
+             .stage = Shader_Info.stage,
+             .entryPoint = Shader_Info.entryPoint,
+             .layoutHash = Layout_Hash };
+}
+
+template<typename KeyType, typename ValueType, typename CallableCreate>
+ValueType device::FindOrCreate(std::map<KeyType, ValueType>& Cache,
+                               const KeyType& Key,
+                               CallableCreate Create)
+{
+    {
+        std::scoped_lock lock(this->objectCacheMutex);
+        auto cachedObject = Cache.find(Key);
+        if (cachedObject != Cache.end()) {
+            return cachedObject->second;
+        }
+    }
+
+    // Create the object without holding the lock so that different objects
+    // can be created concurrently.
+    ValueType object = Create();
+
+    std::scoped_lock lock(this->objectCacheMutex);
+    auto [cachedObject, inserted] = Cache.try_emplace(Key, std::move(object));
+    return cachedObject->second;
+}
+
+shader_ptr device::LoadShaderFromSpirVFile(const shader_info& Shader_Info)
+{
+    file_view_ptr code = this->MapShaderCode(Shader_Info);
+    if (code == nullptr) {
+        return nullptr;
+    }
+    return this->FindOrCreate(
+        this->shaderCache,
+        GetShaderCacheKey(Shader_Info, code, 0),
+        [&]() {
+            return std::make_shared<internal::shader_public_constructor>(
+                this->CreateShaderModule(code),
+                Shader_Info.stage,
+                Shader_Info.entryPoint);
+        });
 }
 
 vertex_shader_ptr device::LoadVertexShaderFromSpirVFile(
     const vertex_shader_info& Vertex_Shader_Info)
 {
-    shader_ptr genericShader =
-        LoadShaderFromSpirVFile(Vertex_Shader_Info.general);
-    return std::make_shared<internal::vertex_shader_public_constructor>(
-        std::move(genericShader->handle),
-        genericShader->stage,
-        genericShader->entryPoint,
-        Vertex_Shader_Info.bindingDescriptions,
-        Vertex_Shader_Info.attributeDescriptions);
+    file_view_ptr code = this->MapShaderCode(Vertex_Shader_Info.general);
+    if (code == nullptr) {
+        return nullptr;
+    }
+
+    // Vertex shaders with different input layouts are different objects.
+    uint64_t layoutHash = internal::Fnv1a64(
+        Vertex_Shader_Info.bindingDescriptions.data(),
+        Vertex_Shader_Info.bindingDescriptions.size() *
+            sizeof(vk::VertexInputBindingDescription));
+    layoutHash = internal::Fnv1a64(
+        Vertex_Shader_Info.attributeDescriptions.data(),
+        Vertex_Shader_Info.attributeDescriptions.size() *
+            sizeof(vk::VertexInputAttributeDescription),
+        layoutHash);
+
+    return this->FindOrCreate(
+        this->vertexShaderCache,
+        GetShaderCacheKey(Vertex_Shader_Info.general, code, layoutHash),
+        [&]() {
+            return std::make_shared<
+                internal::vertex_shader_public_constructor>(
+                this->CreateShaderModule(code),
+                Vertex_Shader_Info.general.stage,
+                Vertex_Shader_Info.general.entryPoint,
+                Vertex_Shader_Info.bindingDescriptions,
+                Vertex_Shader_Info.attributeDescriptions);
+        });
 }
 
 fragment_shader_ptr device::LoadFragmentShaderFromSpirVFile(
     const fragment_shader_info& Fragment_Shader_Info)
 {
-    // NOLINTBEGIN
-    shader_ptr genericShader =
-        LoadShaderFromSpirVFile(Fragment_Shader_Info.general);
-    // NOLINTEND
-    return std::make_shared<internal::fragment_shader_public_constructor>(
-        std::move(genericShader->handle),
-        genericShader->stage,
-        genericShader->entryPoint);
+    file_view_ptr code = this->MapShaderCode(Fragment_Shader_Info.general);
+    if (code == nullptr) {
+        return nullptr;
+    }
+    return this->FindOrCreate(
+        this->fragmentShaderCache,
+        GetShaderCacheKey(Fragment_Shader_Info.general, code, 0),
+        [&]() {
+            return std::make_shared<
+                internal::fragment_shader_public_constructor>(
+                this->CreateShaderModule(code),
+                Fragment_Shader_Info.general.stage,
+                Fragment_Shader_Info.general.entryPoint);
+        });
+}
+
+void device::ClearShaderCache()
+{
+    std::scoped_lock lock(this->objectCacheMutex);
+    this->shaderCache.clear();
+    this->vertexShaderCache.clear();
+    this->fragmentShaderCache.clear();
 }
 
 buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
 {
     buffer_ptr buffer = std::make_shared<internal::buffer_public_constructor>(
-        Buffer_Info.sizeInBytes,
-        vk::UniqueBuffer(nullptr),
-        vk::UniqueDeviceMemory(nullptr));
+        Buffer_Info.sizeInBytes, nullptr, vk::UniqueBuffer(nullptr));
 
     vk::BufferCreateInfo bufferCreateInfo = {
         .size = buffer->size,
@@ -148,37 +589,115 @@ buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
     vk::MemoryRequirements memoryRequirements =
         this->handle->getBufferMemoryRequirements(buffer->handle.get());
 
-    vk::PhysicalDeviceMemoryProperties memoryProperties =
-        this->physicalDevice.getMemoryProperties();
+    const std::vector<uint32_t>& memoryTypes = this->FindMemoryTypes(
+        memoryRequirements.memoryTypeBits, Buffer_Info.memoryProperties);
+    if (memoryTypes.empty()) {
+        ErrorCallback(
+            "Failed to find a viable memory type for a Vulkan buffer.");
+        return nullptr;
+    }
 
-    std::optional<uint32_t> memoryTypeIndex;
-    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
-        if (((memoryRequirements.memoryTypeBits & (1 << i)) != 0U) &&
-            ((memoryProperties.memoryTypes.at(i).propertyFlags &
-              Buffer_Info.memoryProperties) == Buffer_Info.memoryProperties)) {
-            memoryTypeIndex = i;
+    // Fall back to worse memory types when better ones are exhausted.
+    for (size_t i = 0; i < memoryTypes.size(); ++i) {
+        try {
+            buffer->allocation =
+                this->memoryAllocator->Allocate(memoryRequirements,
+                                                memoryTypes.at(i),
+                                                Buffer_Info.category,
+                                                Buffer_Info.owner);
+            break;
+        } catch (const vk::OutOfDeviceMemoryError&) {
+            if (i + 1 == memoryTypes.size()) {
+                throw;
+            }
         }
     }
 
-    if (memoryTypeIndex.has_value() == false) {
-        ErrorCallback(
-            "Failed to find a viable memory type for a Vulkan buffer.");
+    this->handle->bindBufferMemory(buffer->handle.get(),
+                                   buffer->allocation->GetMemory(),
+                                   buffer->allocation->GetOffset());
+
+    this->CheckMemoryBudget();
+
+    return buffer;
+}
+
+upload_batch_ptr device::BeginUploadBatch()
+{
+    return std::make_shared<internal::upload_batch_public_constructor>(
+        this->shared_from_this());
+}
+
+memory_allocator_statistics device::GetAllocatorStatistics()
+{
+    return this->memoryAllocator->GetStatistics();
+}
+
+memory_stats device::GetMemoryStats()
+{
+    memory_stats stats = this->memoryAllocator->GetMemoryStats();
+    if (!this->memoryBudgetSupported) {
+        for (auto& heap : stats.heaps) {
+            heap.budget = heap.size;
+            heap.processUsage = heap.allocatedBytes;
+        }
+        return stats;
     }
 
-    vk::MemoryAllocateInfo memoryAllocateInfo = { .allocationSize =
-                                                      memoryRequirements.size,
-                                                  .memoryTypeIndex =
-                                                      memoryTypeIndex.value() };
-    buffer->memory = this->handle->allocateMemoryUnique(memoryAllocateInfo);
+    auto memoryProperties2 = this->physicalDevice.getMemoryProperties2<
+        vk::PhysicalDeviceMemoryProperties2,
+        vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+    const auto& memoryBudget =
+        memoryProperties2.get<vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+    stats.budgetQueried = true;
+    for (size_t i = 0; i < stats.heaps.size(); ++i) {
+        stats.heaps.at(i).budget = memoryBudget.heapBudget.at(i);
+        stats.heaps.at(i).processUsage = memoryBudget.heapUsage.at(i);
+    }
+    return stats;
+}
 
-    this->handle->bindBufferMemory(
-        buffer->handle.get(), buffer->memory.get(), 0);
+void device::CheckMemoryBudget()
+{
+    std::scoped_lock lock(this->memoryBudgetMutex);
+    vk::DeviceSize allocatedBytes =
+        this->memoryAllocator->GetStatistics().allocatedBytes;
+    if (allocatedBytes == this->budgetCheckedAllocatedBytes) {
+        return;
+    }
+    this->budgetCheckedAllocatedBytes = allocatedBytes;
 
-    return buffer;
+    memory_stats stats = this->GetMemoryStats();
+    for (size_t i = 0; i < stats.heaps.size(); ++i) {
+        const memory_heap_stats& heap = stats.heaps.at(i);
+        bool overThreshold =
+            static_cast<double>(heap.processUsage) >
+            static_cast<double>(heap.budget) *
+                static_cast<double>(this->memoryBudgetWarningThreshold);
+        if (overThreshold && !this->heapsOverBudgetThreshold.at(i)) {
+            WarningCallback(("Memory heap " + std::to_string(i) + " is using " +
+                             std::to_string(heap.processUsage) + " of its " +
+                             std::to_string(heap.budget) + " byte budget.")
+                                .c_str());
+        }
+        this->heapsOverBudgetThreshold.at(i) = overThreshold;
+    }
 }
 
 render_pass_ptr device::CreateRenderPass(
     const render_pass_info& Render_Pass_Info)
+{
+    render_pass_cache_key key = { Render_Pass_Info.format,
+                                  Render_Pass_Info.samples,
+                                  Render_Pass_Info.graphicsAttachment,
+                                  Render_Pass_Info.graphicsLayout };
+    return this->FindOrCreate(this->renderPassCache, key, [&]() {
+        return this->BuildRenderPass(Render_Pass_Info);
+    });
+}
+
+render_pass_ptr device::BuildRenderPass(
+    const render_pass_info& Render_Pass_Info)
 {
     // Describe how to use the attachment.
     vk::AttachmentDescription attachmentDescription = {
@@ -351,7 +870,154 @@ swapchain_ptr device::CreateSwapchain(const swapchain_info& Swapchain_Info)
     return swapchainInfo;
 }
 
+device::pipeline_cache_key device::GetPipelineCacheKey(
+    const pipeline_info& Pipeline_Info)
+{
+    const vertex_shader_ptr& vertexShader = Pipeline_Info.shaders.vertex;
+    const fragment_shader_ptr& fragmentShader = Pipeline_Info.shaders.fragment;
+
+    uint64_t vertexLayoutHash = internal::Fnv1a64(
+        vertexShader->bindingDescriptions.data(),
+        vertexShader->bindingDescriptions.size() *
+            sizeof(vk::VertexInputBindingDescription));
+    vertexLayoutHash = internal::Fnv1a64(
+        vertexShader->attributeDescriptions.data(),
+        vertexShader->attributeDescriptions.size() *
+            sizeof(vk::VertexInputAttributeDescription),
+        vertexLayoutHash);
+
+    return { .vertexShader = vertexShader->handle.get(),
+             .vertexEntryPoint = vertexShader->entryPoint,
+             .fragmentShader = fragmentShader->handle.get(),
+             .fragmentEntryPoint = fragmentShader->entryPoint,
+             .vertexLayoutHash = vertexLayoutHash,
+             .dynamicStates = Pipeline_Info.dynamicStates,
+             .renderPass = Pipeline_Info.renderPass->handle.get() };
+}
+
+std::shared_future<pipeline_ptr> device::FindOrBuildPipeline(
+    const pipeline_info& Pipeline_Info,
+    bool Asynchronous)
+{
+    pipeline_cache_key key = GetPipelineCacheKey(Pipeline_Info);
+    auto build = [this, key](const pipeline_info& Owned_Pipeline_Info,
+                             uint64_t Build) {
+        try {
+            return this->BuildPipeline(Owned_Pipeline_Info);
+        } catch (...) {
+            // Remove the entry only if it was not replaced by another build
+            // after the cache was cleared.
+            std::scoped_lock lock(this->objectCacheMutex);
+            auto failedPipeline = this->pipelineObjectCache.find(key);
+            if (failedPipeline != this->pipelineObjectCache.end() &&
+                failedPipeline->second.build == Build) {
+                this->pipelineObjectCache.erase(failedPipeline);
+            }
+            throw;
+        }
+    };
+
+    std::promise<pipeline_ptr> promise;
+    std::shared_future<pipeline_ptr> pipeline;
+    uint64_t buildId = 0;
+    {
+        std::scoped_lock lock(this->objectCacheMutex);
+        auto cachedPipeline = this->pipelineObjectCache.find(key);
+        if (cachedPipeline != this->pipelineObjectCache.end()) {
+            return cachedPipeline->second.pipeline;
+        }
+        buildId = this->nextPipelineBuild++;
+
+        if (Asynchronous) {
+            // Submitted while the cache is locked so that a failing build
+            // cannot try to remove its entry before the entry is inserted.
+            owned_pipeline_info owned = {
+                .shaders = Pipeline_Info.shaders,
+                .dynamicStates = Pipeline_Info.dynamicStates,
+                .renderPass = Pipeline_Info.renderPass
+            };
+            auto buildOwned = [build, buildId, owned = std::move(owned)]() {
+                return build({ .shaders = owned.shaders,
+                               .dynamicStates = owned.dynamicStates,
+                               .renderPass = owned.renderPass },
+                             buildId);
+            };
+            pipeline =
+                internal::global::THREAD_POOL.Submit(std::move(buildOwned))
+                    .share();
+        } else {
+            pipeline = promise.get_future().share();
+        }
+        this->pipelineObjectCache.try_emplace(
+            key,
+            pipeline_cache_entry{ .pipeline = pipeline,
+                                  .shaders = Pipeline_Info.shaders,
+                                  .renderPass = Pipeline_Info.renderPass,
+                                  .build = buildId });
+    }
+
+    if (!Asynchronous) {
+        // Compile without holding the lock. Other threads requesting the same
+        // pipeline wait on the future instead of compiling it again.
+        try {
+            promise.set_value(build(Pipeline_Info, buildId));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+    return pipeline;
+}
+
+void device::WaitForPipelines()
+{
+    std::vector<std::shared_future<pipeline_ptr>> pipelines;
+    {
+        std::scoped_lock lock(this->objectCacheMutex);
+        pipelines.reserve(this->pipelineObjectCache.size());
+        for (const auto& [key, entry] : this->pipelineObjectCache) {
+            pipelines.push_back(entry.pipeline);
+        }
+    }
+    // Failed builds remove their own entries, so wait without the lock.
+    for (const auto& pipeline : pipelines) {
+        pipeline.wait();
+    }
+}
+
 pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
+{
+    return this->FindOrBuildPipeline(Pipeline_Info, false).get();
+}
+
+std::shared_future<pipeline_ptr> device::CreatePipelineAsync(
+    const pipeline_info& Pipeline_Info)
+{
+    return this->FindOrBuildPipeline(Pipeline_Info, true);
+}
+
+std::vector<std::shared_future<pipeline_ptr>> device::PrewarmPipelines(
+    const std::vector<pipeline_info>& Pipeline_Infos)
+{
+    std::vector<std::shared_future<pipeline_ptr>> pipelines;
+    pipelines.reserve(Pipeline_Infos.size());
+    for (const auto& pipelineInfo : Pipeline_Infos) {
+        pipelines.emplace_back(this->FindOrBuildPipeline(pipelineInfo, true));
+    }
+    return pipelines;
+}
+
+void device::ClearPipelineCache()
+{
+    std::scoped_lock lock(this->objectCacheMutex);
+    std::erase_if(this->pipelineObjectCache, [](const auto& Entry) {
+        return Entry.second.pipeline.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+    });
+    // Pipelines that are still compiling hold their own render passes.
+    this->renderPassCache.clear();
+}
+
+pipeline_ptr device::BuildPipeline(const pipeline_info& Pipeline_Info)
 {
     // Pipeline dynamic states (selects what is configurable after pipeline
     // creation).
@@ -470,18 +1136,58 @@ pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
         .pColorBlendState = &pipelineColorBlendStateCreateInfo,
         .pDynamicState = &dynamicState,
         .layout = pipeline->layout.get(),
-        .renderPass = Pipeline_Info.renderPass,
+        .renderPass = Pipeline_Info.renderPass->handle.get(),
         .subpass = 0,
         .basePipelineHandle = VK_NULL_HANDLE, // optional
         .basePipelineIndex = -1,              // optional
     };
-    pipeline->handle = this->handle
-                           ->createGraphicsPipelineUnique(
-                               VK_NULL_HANDLE, graphicsPipelineCreateInfo)
-                           .value;
+    pipeline->handle =
+        this->handle
+            ->createGraphicsPipelineUnique(this->pipelineCache.get(),
+                                           graphicsPipelineCreateInfo)
+            .value;
     // The vertex shader and fragment shader modules may now destroyed.
 
     return pipeline;
 }
 
+bool device::SavePipelineCache()
+{
+    if (this->pipelineCachePath.empty()) {
+        return false;
+    }
+    std::vector<uint8_t> data =
+        this->handle->getPipelineCacheData(this->pipelineCache.get());
+
+    // Write to a temporary file and then replace the old file so that the
+    // pipeline cache is never left partially written. Logical devices on the
+    // same physical device share the cache file, so each device writes its own
+    // temporary file.
+    std::string temporaryPath =
+        this->pipelineCachePath + "." +
+        std::to_string(reinterpret_cast<uintptr_t>(this)) + ".tmp"; // NOLINT
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), // NOLINT
+                   static_cast<std::streamsize>(data.size()));
+        file.close();
+        if (file.fail()) {
+            ErrorCallback(("Failed to write pipeline cache \"" +
+                           temporaryPath + "\".")
+                              .c_str());
+            return false;
+        }
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryPath, this->pipelineCachePath, errorCode);
+    if (errorCode) {
+        std::filesystem::remove(temporaryPath, errorCode);
+        ErrorCallback(("Failed to replace pipeline cache \"" +
+                       this->pipelineCachePath + "\".")
+                          .c_str());
+        return false;
+    }
+    return true;
+}
+
 } // namespace gvw
\ No newline at end of file
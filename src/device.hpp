@@ -7,12 +7,19 @@
  * @date 2023-07-26
  */
 
+// Standard includes
+#include <map>
+#include <string>
+#include <tuple>
+
 // Local includes
 #include "gvw.ipp"
 
 namespace gvw {
 
-class device : internal::uncopyable_unmovable // NOLINT
+class device
+    : internal::uncopyable_unmovable // NOLINT
+    , public std::enable_shared_from_this<device>
 {
     friend internal::device_public_constructor;
 
@@ -24,7 +31,9 @@ class device : internal::uncopyable_unmovable // NOLINT
 
   public:
     // The destructor is public to allow explicit destruction.
-    ~device() = default;
+    /// @remark Waits for pipelines that are still compiling and saves the
+    /// pipeline cache if a pipeline cache path was given.
+    ~device();
 
   private:
     ////////////////////////////////////////////////////////////////////////////
@@ -35,10 +44,193 @@ class device : internal::uncopyable_unmovable // NOLINT
 
     vk::UniqueDevice handle;
     vk::PhysicalDevice physicalDevice;
+
+    /// @brief Queried once at construction. These never change for the
+    /// lifetime of a physical device.
+    vk::PhysicalDeviceProperties properties;
+    vk::PhysicalDeviceFeatures features;
+    vk::PhysicalDeviceMemoryProperties memoryProperties;
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties;
+
     vk::SurfaceFormatKHR surfaceFormat;
     vk::PresentModeKHR presentMode;
     std::vector<device_selection_queue_family_info> queueFamilyInfos;
 
+    /// @brief The extensions and features enabled on the logical device.
+    std::vector<std::string> enabledExtensions;
+    device_features enabledFeatures;
+
+    /// @brief Suballocates the memory of buffers created by this device.
+    memory_allocator_ptr memoryAllocator;
+
+    /// @brief Whether VK_EXT_memory_budget is enabled.
+    bool memoryBudgetSupported = false;
+    float memoryBudgetWarningThreshold;
+
+    /// @brief Whether a warning has been reported for each heap since its
+    /// usage last fell below the warning threshold.
+    std::vector<bool> heapsOverBudgetThreshold;
+
+    /// @brief The device memory allocated when budgets were last checked.
+    vk::DeviceSize budgetCheckedAllocatedBytes = 0;
+    std::mutex memoryBudgetMutex;
+
+    /// @brief Pipelines created by this device. Seeded from and saved to
+    /// `pipelineCachePath` if it is not empty.
+    vk::UniquePipelineCache pipelineCache;
+    std::string pipelineCachePath;
+
+    /// @brief Identifies a shader by its code, stage, entry point, and vertex
+    /// input layout.
+    struct shader_cache_key
+    {
+        uint64_t codeHash = 0;
+        size_t codeSize = 0;
+        vk::ShaderStageFlagBits stage = {};
+        std::string entryPoint;
+        uint64_t layoutHash = 0;
+
+        auto operator<=>(const shader_cache_key&) const = default;
+    };
+
+    /// @brief Shaders that have already been loaded by this device. Declared
+    /// after the device handle so that the shader modules are destroyed first.
+    std::map<shader_cache_key, shader_ptr> shaderCache;
+    std::map<shader_cache_key, vertex_shader_ptr> vertexShaderCache;
+    std::map<shader_cache_key, fragment_shader_ptr> fragmentShaderCache;
+
+    /// @brief Identifies a render pass by the parameters used to create it.
+    using render_pass_cache_key = std::
+        tuple<vk::Format, vk::SampleCountFlagBits, uint32_t, vk::ImageLayout>;
+
+    /// @brief Render passes that have already been created by this device.
+    /// Pipelines are keyed by render pass handle, so sharing render passes
+    /// allows pipelines to be shared between windows.
+    std::map<render_pass_cache_key, render_pass_ptr> renderPassCache;
+
+    /// @brief Identifies a pipeline by every piece of state used to create it.
+    struct pipeline_cache_key
+    {
+        vk::ShaderModule vertexShader;
+        std::string vertexEntryPoint;
+        vk::ShaderModule fragmentShader;
+        std::string fragmentEntryPoint;
+        uint64_t vertexLayoutHash = 0;
+        std::vector<vk::DynamicState> dynamicStates;
+        vk::RenderPass renderPass;
+
+        auto operator<=>(const pipeline_cache_key&) const = default;
+    };
+
+    /// @brief A cached pipeline, which may still be compiling. Holds the
+    /// shaders and render pass used to create it so that their handles cannot
+    /// be reused by other objects while it is cached.
+    struct pipeline_cache_entry
+    {
+        std::shared_future<pipeline_ptr> pipeline;
+        pipeline_shaders shaders;
+        render_pass_ptr renderPass;
+
+        /// @brief Identifies the build that produces `pipeline`.
+        uint64_t build;
+    };
+
+    /// @brief A copy of a pipeline_info that owns the objects it references so
+    /// that it can outlive the caller on a worker thread.
+    struct owned_pipeline_info
+    {
+        pipeline_shaders shaders;
+        pipeline_dynamic_states dynamicStates;
+        render_pass_ptr renderPass;
+    };
+
+    /// @brief Pipelines that have already been created by this device.
+    std::map<pipeline_cache_key, pipeline_cache_entry> pipelineObjectCache;
+
+    /// @brief The identifier of the next pipeline build. Guarded by
+    /// `objectCacheMutex`.
+    uint64_t nextPipelineBuild = 0;
+
+    /// @brief Ranked memory types keyed by the memory type bits of a resource
+    /// in the upper 32 bits and the required property flags in the lower 32.
+    std::map<uint64_t, std::vector<uint32_t>> memoryTypeCache;
+
+    std::mutex objectCacheMutex;
+
+    /// @brief Every queue created with the device, keyed by queue family index
+    /// and queue index.
+    std::map<std::pair<uint32_t, uint32_t>, queue_ptr> queues;
+
+    /// @brief The queue index within each queue family that is handed out
+    /// next by `GetNextQueueIndex`.
+    std::map<uint32_t, uint32_t> nextQueueIndices;
+    std::mutex nextQueueIndicesMutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns a view of the SPIR-V code of a shader, or nullptr on
+    /// failure.
+    [[nodiscard]] static file_view_ptr MapShaderCode(
+        const shader_info& Shader_Info);
+
+    [[nodiscard]] vk::UniqueShaderModule CreateShaderModule(
+        const file_view_ptr& Code);
+
+    [[nodiscard]] static shader_cache_key GetShaderCacheKey(
+        const shader_info& Shader_Info,
+        const file_view_ptr& Code,
+        uint64_t Layout_Hash);
+
+    /// @brief Returns the contents of the pipeline cache file if it was created
+    /// by the same driver for the same physical device. Otherwise returns an
+    /// empty vector.
+    [[nodiscard]] std::vector<char> LoadPipelineCacheData() const;
+
+    /// @brief Returns the memory types allowed by a resource that have all of
+    /// the given properties. The best memory type is first: types with fewer
+    /// unrequested properties are preferred, then types on larger heaps.
+    [[nodiscard]] const std::vector<uint32_t>& FindMemoryTypes(
+        uint32_t Memory_Type_Bits,
+        vk::MemoryPropertyFlags Memory_Properties);
+
+    /// @brief Reports a warning for each memory heap whose usage has crossed
+    /// the warning threshold of its budget. Only queries the driver if device
+    /// memory has been allocated or freed since the last check.
+    void CheckMemoryBudget();
+
+    /// @brief Returns a cached object or creates and caches a new one. The
+    /// object is created without holding the cache mutex.
+    template<typename KeyType, typename ValueType, typename CallableCreate>
+    [[nodiscard]] ValueType FindOrCreate(std::map<KeyType, ValueType>& Cache,
+                                         const KeyType& Key,
+                                         CallableCreate Create);
+
+    /// @brief Creates a new render pass without consulting the render pass
+    /// cache.
+    [[nodiscard]] render_pass_ptr BuildRenderPass(
+        const render_pass_info& Render_Pass_Info);
+
+    /// @brief Creates a new pipeline without consulting the pipeline object
+    /// cache.
+    [[nodiscard]] pipeline_ptr BuildPipeline(
+        const pipeline_info& Pipeline_Info);
+
+    [[nodiscard]] static pipeline_cache_key GetPipelineCacheKey(
+        const pipeline_info& Pipeline_Info);
+
+    /// @brief Returns the cached future for a pipeline. If the pipeline is not
+    /// cached, it is compiled on the calling thread or, if asynchronous, on a
+    /// worker thread. Pipelines that fail to compile are removed from the
+    /// cache.
+    [[nodiscard]] std::shared_future<pipeline_ptr> FindOrBuildPipeline(
+        const pipeline_info& Pipeline_Info,
+        bool Asynchronous);
+
+    /// @brief Blocks until every pipeline in the cache has finished compiling.
+    void WaitForPipelines();
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     ///                        Public Member Functions                       ///
@@ -55,6 +247,46 @@ class device : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] std::vector<device_selection_queue_family_info>
     GetQueueFamilyInfos() const;
 
+    /// @brief Returns the index of a queue within a queue family. Successive
+    /// calls cycle through the queues created for the family so that windows
+    /// and threads are spread across distinct queues.
+    [[nodiscard]] uint32_t GetNextQueueIndex(uint32_t Queue_Family_Index);
+
+    /// @brief Returns a queue created with the device, or nullptr if the queue
+    /// was not created.
+    [[nodiscard]] queue_ptr GetQueue(uint32_t Queue_Family_Index,
+                                     uint32_t Queue_Index);
+
+    /// @brief Returns the next queue of a queue family as selected by
+    /// `GetNextQueueIndex`.
+    [[nodiscard]] queue_ptr AcquireQueue(uint32_t Queue_Family_Index);
+
+    /// @brief Waits for every queue of the device to become idle.
+    /// @remark Unlike vkDeviceWaitIdle, this is safe to call while other
+    /// threads submit to the queues.
+    void WaitIdle();
+
+    [[nodiscard]] const vk::PhysicalDeviceProperties& GetProperties() const;
+
+    [[nodiscard]] const vk::PhysicalDeviceLimits& GetLimits() const;
+
+    [[nodiscard]] const vk::PhysicalDeviceFeatures& GetFeatures() const;
+
+    [[nodiscard]] const vk::PhysicalDeviceMemoryProperties&
+    GetMemoryProperties() const;
+
+    [[nodiscard]] const std::vector<vk::QueueFamilyProperties>&
+    GetQueueFamilyProperties() const;
+
+    /// @brief Returns true if this device enables every extension and feature
+    /// selected by the device selection info, uses one of its surface formats
+    /// and present modes, and can present to the surface.
+    [[nodiscard]] bool IsCompatible(
+        const device_selection_info& Device_Selection_Info,
+        vk::SurfaceKHR Surface) const;
+
+    /// @brief Loads a shader module, or returns the one already loaded from
+    /// identical code with the same stage and entry point.
     [[nodiscard]] shader_ptr LoadShaderFromSpirVFile(
         const shader_info& Shader_Info);
 
@@ -64,9 +296,31 @@ class device : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] fragment_shader_ptr LoadFragmentShaderFromSpirVFile(
         const fragment_shader_info& Fragment_Shader_Info);
 
+    /// @brief Releases the references held by the shader cache. Shaders still
+    /// in use elsewhere remain valid.
+    void ClearShaderCache();
+
+    /// @brief Creates a buffer with memory suballocated from a shared block.
+    /// Large buffers receive dedicated memory. Host visible memory is mapped
+    /// for the lifetime of the buffer.
     [[nodiscard]] buffer_ptr CreateBuffer(
         const buffer_info& Buffer_Info = buffer_info_config::DEFAULT);
 
+    /// @brief Begins a batch of uploads to buffers created by this device. The
+    /// uploads are submitted together by upload_batch::Submit.
+    [[nodiscard]] upload_batch_ptr BeginUploadBatch();
+
+    /// @brief Returns block, allocation, and fragmentation statistics for the
+    /// memory of buffers created by this device.
+    [[nodiscard]] memory_allocator_statistics GetAllocatorStatistics();
+
+    /// @brief Returns a snapshot of the memory allocated and used by this
+    /// device per heap, memory type, category, and owner, along with the
+    /// budget of each heap.
+    [[nodiscard]] memory_stats GetMemoryStats();
+
+    /// @brief Creates a render pass, or returns the one already created with
+    /// the same parameters.
     [[nodiscard]] render_pass_ptr CreateRenderPass(
         const render_pass_info& Render_Pass_Info =
             render_pass_info_config::DEFAULT);
@@ -74,8 +328,34 @@ class device : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] swapchain_ptr CreateSwapchain(
         const swapchain_info& Swapchain_Info = swapchain_info_config::DEFAULT);
 
+    /// @brief Creates a pipeline, or returns the one already created with the
+    /// same shaders, vertex layout, dynamic states, and render pass.
     [[nodiscard]] pipeline_ptr CreatePipeline(
         const pipeline_info& Pipeline_Info = pipeline_info_config::DEFAULT);
+
+    /// @brief Compiles a pipeline on a worker thread. The pipeline is cached
+    /// immediately, so CreatePipeline waits for it instead of compiling it
+    /// again. Errors are rethrown by the future.
+    /// @warning Must not be waited on from a task running on the GVW thread
+    /// pool.
+    [[nodiscard]] std::shared_future<pipeline_ptr> CreatePipelineAsync(
+        const pipeline_info& Pipeline_Info = pipeline_info_config::DEFAULT);
+
+    /// @brief Starts compiling pipelines on worker threads so that they are
+    /// ready by the time they are first drawn with. The returned futures may be
+    /// waited on or discarded.
+    std::vector<std::shared_future<pipeline_ptr>> PrewarmPipelines(
+        const std::vector<pipeline_info>& Pipeline_Infos);
+
+    /// @brief Releases the references held by the render pass and pipeline
+    /// caches. Objects still in use elsewhere remain valid. Pipelines that are
+    /// still compiling, and the render passes they use, remain cached.
+    void ClearPipelineCache();
+
+    /// @brief Writes the pipeline cache to the pipeline cache path. The file is
+    /// replaced atomically so that an interrupted write never corrupts it.
+    /// Returns false on failure or if no path was given.
+    bool SavePipelineCache();
 };
 
 } // namespace gvw
\ No newline at end of file
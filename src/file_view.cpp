@@ -0,0 +1,178 @@
+// Standard includes
+#include <string>
+
+// External includes
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Local includes
+#include "gvw.ipp"
+#include "file_view.hpp"
+
+namespace gvw {
+
+file_view::file_view(const char* Path)
+{
+    if (Path == nullptr) {
+        ErrorCallback("Failed to map file. Path is NULL.");
+        return;
+    }
+    std::string failureMessage =
+        "Failed to map file \"" + static_cast<std::string>(Path) + "\".";
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(Path,
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) == 0) {
+        CloseHandle(file);
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    if (fileSize.QuadPart == 0) {
+        // Empty files cannot be mapped.
+        CloseHandle(file);
+        this->opened = true;
+        return;
+    }
+    HANDLE fileMapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (fileMapping == nullptr) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(fileMapping);
+    if (view == nullptr) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    this->mappingSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int file = open(Path, O_RDONLY | O_CLOEXEC); // NOLINT
+    if (file == -1) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    struct stat fileStatus = {};
+    if (fstat(file, &fileStatus) == -1) {
+        close(file);
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    if (fileStatus.st_size == 0) {
+        // Empty files cannot be mapped.
+        close(file);
+        this->opened = true;
+        return;
+    }
+    void* view = mmap(nullptr,
+                      static_cast<size_t>(fileStatus.st_size),
+                      PROT_READ,
+                      MAP_PRIVATE,
+                      file,
+                      0);
+    // The mapping remains valid after the file is closed.
+    close(file);
+    if (view == MAP_FAILED) { // NOLINT
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    this->mappingSize = static_cast<size_t>(fileStatus.st_size);
+#endif
+
+    this->mapping = view;
+    this->data = static_cast<const uint8_t*>(view);
+    this->size = this->mappingSize;
+    this->opened = true;
+}
+
+file_view::file_view(file_view_ptr Parent, size_t Offset, size_t Size)
+    : parent(std::move(Parent))
+    , data(this->parent->data + Offset) // NOLINT
+    , size(Size)
+    , opened(true)
+{
+}
+
+file_view::~file_view()
+{
+    if (this->mapping == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(this->mapping);
+#else
+    munmap(this->mapping, this->mappingSize);
+#endif
+}
+
+const uint8_t* file_view::GetData() const
+{
+    return this->data;
+}
+
+size_t file_view::GetSize() const
+{
+    return this->size;
+}
+
+std::span<const uint8_t> file_view::GetBytes() const
+{
+    return { this->data, this->size };
+}
+
+file_view_ptr file_view::Slice(size_t Offset, size_t Size)
+{
+    if (Offset > this->size || Size > this->size - Offset) {
+        ErrorCallback("File view slice is out of bounds.");
+        return nullptr;
+    }
+    return std::make_shared<internal::file_view_public_constructor>(
+        this->shared_from_this(), Offset, Size);
+}
+
+file_view_ptr MapFile(const char* Path)
+{
+    if (Path != nullptr) {
+        file_view_ptr archivedFile = internal::FindInMountedArchives(Path);
+        if (archivedFile != nullptr) {
+            return archivedFile;
+        }
+    }
+    return internal::MapFileFromFileSystem(Path);
+}
+
+namespace internal {
+
+file_view_ptr MapFileFromFileSystem(const char* Path)
+{
+    file_view_ptr view =
+        std::make_shared<internal::file_view_public_constructor>(Path);
+    if (!view->opened) {
+        return nullptr;
+    }
+    return view;
+}
+
+} // namespace internal
+
+} // namespace gvw
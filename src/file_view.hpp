@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file file_view.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Read-only memory-mapped files.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <span>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief A read-only view of a file mapped into memory.
+/// @remark The contents are paged in by the operating system on first access
+/// and are shared with the page cache, so reading a file through a view never
+/// copies it onto the heap.
+class file_view
+    : internal::uncopyable_unmovable // NOLINT
+    , public std::enable_shared_from_this<file_view>
+{
+    friend internal::file_view_public_constructor;
+
+    friend file_view_ptr internal::MapFileFromFileSystem(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Maps an entire file into memory.
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    file_view(const char* Path);
+
+    /// @brief Creates a view of part of another view.
+    file_view(file_view_ptr Parent, size_t Offset, size_t Size);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~file_view();
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Keeps the mapping of a sliced view alive.
+    file_view_ptr parent = nullptr;
+
+    /// @brief The start and length of the mapping owned by this view. Both are
+    /// empty for sliced views.
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    /// @brief Whether the file was opened successfully.
+    bool opened = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns a pointer to the first byte of the view.
+    [[nodiscard]] const uint8_t* GetData() const;
+
+    /// @brief Returns the size of the view in bytes.
+    [[nodiscard]] size_t GetSize() const;
+
+    /// @brief Returns the bytes of the view.
+    [[nodiscard]] std::span<const uint8_t> GetBytes() const;
+
+    /// @brief Returns a view of part of this view that shares its mapping.
+    /// Returns nullptr if the range is out of bounds.
+    [[nodiscard]] file_view_ptr Slice(size_t Offset, size_t Size);
+};
+
+} // namespace gvw
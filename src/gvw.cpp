@@ -121,12 +121,24 @@ version GetGlfwCompiletimeVersion() noexcept
 
 image::image(const image_file_info& File_Info)
 {
-    this->data = stbi_load(File_Info.path,
-                           &this->size.width,
-                           &this->size.height,
-                           &this->colorComponentsPerPixel,
-                           File_Info.requestedColorComponentsPerPixel);
-    if (this->data == nullptr) {
+    // Decode straight from the page cache instead of reading the file onto
+    // the heap first.
+    file_view_ptr view = nullptr;
+    if (File_Info.path != nullptr) {
+        view = MapFile(File_Info.path);
+    }
+    if (view != nullptr) {
+        this->data =
+            stbi_load_from_memory(view->GetData(),
+                                  static_cast<int>(view->GetSize()),
+                                  &this->size.width,
+                                  &this->size.height,
+                                  &this->colorComponentsPerPixel,
+                                  File_Info.requestedColorComponentsPerPixel);
+    }
+    // MapFile reports its own failures.
+    if (this->data == nullptr &&
+        (File_Info.path == nullptr || view != nullptr)) {
         std::string message;
         if (File_Info.path == nullptr) {
             message =
@@ -135,8 +147,10 @@ image::image(const image_file_info& File_Info)
             message = static_cast<std::string>("Failed to open file \"") +
                       File_Info.path + "\". ";
         }
-        message += static_cast<std::string>("STD error: \"") +
-                   stbi_failure_reason() + "\".";
+        if (view != nullptr) {
+            message += static_cast<std::string>("STD error: \"") +
+                       stbi_failure_reason() + "\".";
+        }
         ErrorCallback(message.c_str());
     }
     if (this->colorComponentsPerPixel <
@@ -149,6 +163,10 @@ image::image(const image_file_info& File_Info)
             " were requested.";
         WarningCallback(message.c_str());
     }
+    this->dataColorComponentsPerPixel =
+        File_Info.requestedColorComponentsPerPixel == 0
+            ? this->colorComponentsPerPixel
+            : File_Info.requestedColorComponentsPerPixel;
 }
 
 image::image(const image_memory_info& Memory_Info)
@@ -176,6 +194,44 @@ image::image(const image_memory_info& Memory_Info)
             " were requested.";
         WarningCallback(message.c_str());
     }
+    this->dataColorComponentsPerPixel =
+        Memory_Info.requestedColorComponentsPerPixel == 0
+            ? this->colorComponentsPerPixel
+            : Memory_Info.requestedColorComponentsPerPixel;
+}
+
+image::image(const image_file_view_info& File_View_Info)
+{
+    if (File_View_Info.view != nullptr) {
+        this->data = stbi_load_from_memory(
+            File_View_Info.view->GetData(),
+            static_cast<int>(File_View_Info.view->GetSize()),
+            &this->size.width,
+            &this->size.height,
+            &this->colorComponentsPerPixel,
+            File_View_Info.requestedColorComponentsPerPixel);
+    }
+    if (this->data == nullptr) {
+        std::string message = "Failed to read image data from file view.";
+        if (File_View_Info.view != nullptr) {
+            message += static_cast<std::string>(" STD error: \"") +
+                       stbi_failure_reason() + "\".";
+        }
+        ErrorCallback(message.c_str());
+    }
+    if (this->colorComponentsPerPixel <
+        File_View_Info.requestedColorComponentsPerPixel) {
+        std::string message =
+            "Image only has " + std::to_string(this->colorComponentsPerPixel) +
+            " color components per pixel but " +
+            std::to_string(File_View_Info.requestedColorComponentsPerPixel) +
+            " were requested.";
+        WarningCallback(message.c_str());
+    }
+    this->dataColorComponentsPerPixel =
+        File_View_Info.requestedColorComponentsPerPixel == 0
+            ? this->colorComponentsPerPixel
+            : File_View_Info.requestedColorComponentsPerPixel;
 }
 
 image::~image()
@@ -188,6 +244,16 @@ area<int> image::GetSize() const
     return this->size;
 }
 
+size_t image::GetSizeInBytes() const
+{
+    if (this->data == nullptr) {
+        return 0;
+    }
+    return static_cast<size_t>(this->size.width) *
+           static_cast<size_t>(this->size.height) *
+           static_cast<size_t>(this->dataColorComponentsPerPixel);
+}
+
 instance_creation_hints::instance_creation_hints(
     const instance_creation_hints_info& Creation_Hints_Info)
     : glfw_hints({ { { GLFW_JOYSTICK_HAT_BUTTONS,
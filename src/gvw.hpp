@@ -8,11 +8,13 @@
  */
 
 // Standard includes
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <vector>
 #include <optional>
 #include <mutex>
+#include <future>
 
 // External includes
 #define VULKAN_HPP_NAMESPACE vk
@@ -76,15 +78,95 @@ template<typename T = char>
 /// @brief Returns the GLFW version used to compile GVW.
 [[nodiscard]] version GetGlfwCompiletimeVersion() noexcept;
 
+/*******************************    File View    ******************************/
+class file_view;
+using file_view_ptr = std::shared_ptr<file_view>;
+
+/// @brief Maps a file into memory for reading. Returns nullptr on failure.
+/// @remark Mounted archives are searched for the path before the file system.
+[[nodiscard]] file_view_ptr MapFile(const char* Path);
+
+/********************************    Archive    *******************************/
+class archive;
+using archive_ptr = std::shared_ptr<archive>;
+struct archive_file_info;
+struct archive_write_info;
+
+/// @brief Maps an archive into memory and validates its index. Returns nullptr
+/// on failure.
+[[nodiscard]] archive_ptr OpenArchive(const char* Path);
+
+/// @brief Packs files into an archive. Returns false on failure.
+[[nodiscard]] bool WriteArchive(const char* Path,
+                                const archive_write_info& Archive_Write_Info);
+
+/// @brief Makes the files in an archive visible to `MapFile` and every loader
+/// built on it. Archives mounted later take precedence.
+void MountArchive(const archive_ptr& Archive);
+
+/// @brief Removes an archive from the mounted archives.
+void UnmountArchive(const archive_ptr& Archive);
+
+/// @brief Removes all mounted archives.
+void UnmountArchives();
+
 /*********************************    Image    ********************************/
 class image;
 using image_ptr = std::shared_ptr<image>;
 struct image_file_info;
 struct image_memory_info;
+struct image_file_view_info;
 
 template<typename T>
 [[nodiscard]] image_ptr CreateImage(const T& Info);
 
+/// @brief Decodes an image on the GVW worker pool.
+/// @remark Memory info is copied into the task. For file info, the path must
+/// remain valid until the returned future is ready.
+template<typename T>
+[[nodiscard]] std::future<image_ptr> CreateImageAsync(const T& Info);
+
+/// @brief Decodes several images in parallel on the GVW worker pool and waits
+/// for all of them. The returned images are in the same order as the infos.
+template<typename T>
+[[nodiscard]] std::vector<image_ptr> CreateImages(const std::vector<T>& Infos);
+
+/******************************    Image Cache    *****************************/
+class image_cache;
+using image_cache_ptr = std::shared_ptr<image_cache>;
+struct image_cache_info;
+namespace image_cache_info_config {
+extern const image_cache_info DEFAULT;
+} // namespace image_cache_info_config
+
+/// @brief Counters describing the effectiveness of an image cache.
+struct image_cache_statistics;
+
+/// @brief Creates a cache that decodes each distinct image only once.
+[[nodiscard]] image_cache_ptr CreateImageCache(
+    const image_cache_info& Image_Cache_Info =
+        image_cache_info_config::DEFAULT);
+
+/*********************************    Atlas    ********************************/
+class atlas;
+using atlas_ptr = std::shared_ptr<atlas>;
+struct atlas_info;
+namespace atlas_info_config {
+extern const atlas_info DEFAULT;
+} // namespace atlas_info_config
+
+/// @brief Identifies an image inserted into an atlas. Remains valid across
+/// repacks.
+using atlas_entry = size_t;
+
+/// @brief Location of an atlas entry within an atlas page.
+struct atlas_region;
+
+/// @brief Creates an atlas for packing many small images into a few large
+/// pages.
+[[nodiscard]] atlas_ptr CreateAtlas(
+    const atlas_info& Atlas_Info = atlas_info_config::DEFAULT);
+
 /*****************************    GVW Instance    *****************************/
 class instance;
 using instance_ptr = std::shared_ptr<instance>;
@@ -247,6 +329,9 @@ extern const instance_glfw_error_callback FORWARD_TO_ERROR_CALLBACK;
 void SetGlfwCallback(instance_glfw_error_callback GLFW_Error_Callback);
 void GlfwErrorCallback(int Error_Code, const char* Message);
 
+/// @brief The time at which an input event was received.
+using event_time = std::chrono::steady_clock::time_point;
+
 /// @brief Joystick ID and event type of a joystick event.
 struct instance_joystick_event;
 
@@ -295,6 +380,7 @@ struct window_info;
 namespace window_info_config {
 extern const window_info DEFAULT;
 } // namespace window_info_config
+struct window_frame_info;
 
 enum struct window_key;
 
@@ -314,6 +400,11 @@ using window_position_event = coordinate<int>;
 using window_iconify_event = int;
 using window_maximize_event = int;
 using window_focus_event = int;
+enum struct window_event_type;
+struct window_event;
+struct window_events;
+struct window_input_latency;
+struct window_input_state;
 
 using window_key_event_callback =
     void (*)(GLFWwindow*, int, int, int, int); // GLFWkeyfun
@@ -422,6 +513,13 @@ extern const window_refresh_event_callback NONE;
 extern const window_refresh_event_callback APPEND_TO_REFRESH_EVENT_BUFFER;
 } // namespace window_refresh_event_callback_config
 
+enum struct window_event_coalescing;
+struct window_event_coalescing_info;
+namespace window_event_coalescing_info_config {
+extern const window_event_coalescing_info KEEP_ALL;
+extern const window_event_coalescing_info BOUNDED;
+} // namespace window_event_coalescing_info_config
+
 struct window_event_callbacks;
 namespace window_event_callbacks_config {
 extern const window_event_callbacks NONE;
@@ -493,6 +591,19 @@ namespace fragment_shader_info_config {
 extern const fragment_shader_info DEFAULT;
 } // namespace fragment_shader_info_config
 
+/***************************    Memory Allocator    ***************************/
+class memory_allocator;
+using memory_allocator_ptr = std::shared_ptr<memory_allocator>;
+class memory_allocation;
+using memory_allocation_ptr = std::shared_ptr<memory_allocation>;
+struct memory_allocator_statistics;
+
+/// @brief The kind of resource that memory was allocated for.
+enum struct memory_category;
+struct memory_heap_stats;
+struct memory_type_stats;
+struct memory_stats;
+
 /********************************    Buffer    ********************************/
 class buffer;
 using buffer_ptr = std::shared_ptr<buffer>;
@@ -501,6 +612,15 @@ namespace buffer_info_config {
 extern const buffer_info DEFAULT;
 } // namespace buffer_info_config
 
+/*****************************    Upload Batch    *****************************/
+class upload_batch;
+using upload_batch_ptr = std::shared_ptr<upload_batch>;
+
+/*********************************    Queue    ********************************/
+class queue;
+using queue_ptr = std::shared_ptr<queue>;
+struct queue_statistics;
+
 /******************************    Render Pass    *****************************/
 class render_pass;
 using render_pass_ptr = std::shared_ptr<render_pass>;
@@ -581,6 +701,10 @@ using device_selection_function =
 namespace device_selection_function_config {
 extern const device_selection_function NONE;
 extern const device_selection_function MINIMUM_FOR_PRESENTATION;
+/// @brief Selects the same physical device and queue families as
+/// `MINIMUM_FOR_PRESENTATION`, but requests several queues from each family so
+/// that windows and threads can submit to distinct queues.
+extern const device_selection_function MULTIPLE_QUEUES;
 } // namespace device_selection_function_config
 
 /// @brief Physical device features.
@@ -606,4 +730,11 @@ namespace device_queue_priority_config {
 extern const device_queue_priority HIGH;
 } // namespace device_queue_priority_config
 
+/// @brief Logical device queue priorities, one per queue of a family.
+using device_queue_priorities = std::vector<device_queue_priority>;
+namespace device_queue_priorities_config {
+/// @brief The first queue of a family has the highest priority.
+extern const device_queue_priorities DESCENDING;
+} // namespace device_queue_priorities_config
+
 } // namespace gvw
\ No newline at end of file
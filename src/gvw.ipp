@@ -8,7 +8,10 @@
  */
 
 // Standard includes
+#include <array>
+#include <chrono>
 #include <fstream>
+#include <map>
 
 // Local includes
 #include "gvw.hpp"
@@ -391,6 +394,24 @@ std::vector<T> ReadFile(const char* Absolute_Path)
     return charBuffer;
 }
 
+struct archive_file_info
+{
+    /// @brief The name used to find the file within the archive.
+    std::string name;
+
+    /// @brief The path of the file to pack.
+    std::string path;
+};
+
+struct archive_write_info
+{
+    std::vector<archive_file_info> files;
+
+    /// @brief The alignment in bytes of each file within the archive. Must be a
+    /// power of two. SPIR-V requires at least 4.
+    uint32_t alignment = 16; // NOLINT
+};
+
 struct image_file_info
 {
     const char* path = nullptr;
@@ -403,12 +424,19 @@ struct image_memory_info
     int requestedColorComponentsPerPixel = 4;
 };
 
+struct image_file_view_info
+{
+    file_view_ptr view = nullptr;
+    int requestedColorComponentsPerPixel = 4;
+};
+
 class image
 {
     friend internal::image_public_constructor;
 
     friend cursor;
     friend window;
+    friend atlas;
 
     ////////////////////////////////////////////////////////////////////////////
     ///                Constructors, Operators, and Destructor               ///
@@ -416,6 +444,7 @@ class image
 
     image(const image_file_info& File_Info);
     image(const image_memory_info& Memory_Info);
+    image(const image_file_view_info& File_View_Info);
 
   public:
     image(const image&) = delete;
@@ -433,12 +462,19 @@ class image
     area<int> size = { 0, 0 };
     int colorComponentsPerPixel = 0;
 
+    /// @brief The number of color components per pixel in `data`. This is the
+    /// requested number of components unless zero components were requested.
+    int dataColorComponentsPerPixel = 0;
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     ///                        Public Member Functions                       ///
     ////////////////////////////////////////////////////////////////////////////
 
     [[nodiscard]] area<int> GetSize() const;
+
+    /// @brief Returns the size of the decoded pixel data in bytes.
+    [[nodiscard]] size_t GetSizeInBytes() const;
 };
 
 template<typename T>
@@ -447,6 +483,74 @@ image_ptr CreateImage(const T& Info)
     return std::make_shared<internal::image_public_constructor>(Info);
 }
 
+template<typename T>
+std::future<image_ptr> CreateImageAsync(const T& Info)
+{
+    return internal::global::THREAD_POOL.Submit(
+        [Info]() { return CreateImage(Info); });
+}
+
+template<typename T>
+std::vector<image_ptr> CreateImages(const std::vector<T>& Infos)
+{
+    std::vector<std::future<image_ptr>> futures;
+    futures.reserve(Infos.size());
+    for (const auto& info : Infos) {
+        futures.emplace_back(CreateImageAsync(info));
+    }
+    std::vector<image_ptr> images;
+    images.reserve(Infos.size());
+    for (auto& future : futures) {
+        images.emplace_back(future.get());
+    }
+    return images;
+}
+
+struct image_cache_info
+{
+    /// @brief The maximum total size in bytes of the decoded pixels held by the
+    /// cache. The least recently used images are evicted first.
+    size_t budget = 64 * 1024 * 1024; // NOLINT
+};
+
+struct image_cache_statistics
+{
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    /// @brief The total size in bytes of the decoded pixels held by the cache.
+    size_t size = 0;
+    size_t entries = 0;
+};
+
+struct atlas_info
+{
+    /// @brief The size of each atlas page in pixels.
+    area<int> pageSize = { 1024, 1024 }; // NOLINT
+
+    /// @brief Transparent pixels placed between neighboring images to prevent
+    /// texture filtering from bleeding across image borders.
+    int padding = 1;
+
+    /// @brief The maximum number of pages the atlas may grow to.
+    size_t maxPages = 4; // NOLINT
+
+    /// @brief The fraction of packed area that must be occupied by removed
+    /// images before a failed insertion repacks the atlas instead of opening a
+    /// new page.
+    float repackThreshold = 0.25F; // NOLINT
+};
+
+struct atlas_region
+{
+    size_t page = 0;
+    coordinate<int> position = { 0, 0 };
+    area<int> size = { 0, 0 };
+    coordinate<float> uvMin = { 0.0F, 0.0F };
+    coordinate<float> uvMax = { 0.0F, 0.0F };
+};
+
 struct instance_creation_hints_info
 {
     // Shared hints.
@@ -522,6 +626,7 @@ struct instance_joystick_event
 {
     int jid;
     int event;
+    event_time time;
 };
 
 enum struct window_key
@@ -663,6 +768,34 @@ enum struct window_key_action
     // NOLINTEND
 };
 
+/// @brief How events of the same type received between reads are stored.
+enum struct window_event_coalescing
+{
+    /// @brief Store every event.
+    eKeepAll,
+
+    /// @brief Replace the last stored event with the new one.
+    eKeepLast,
+
+    /// @brief Add the components of the new event to the last stored event.
+    /// Intended for relative events such as scrolling. Treated as `eKeepLast`
+    /// for size events.
+    eAccumulate
+};
+
+/// @brief Coalescing policies for high-frequency events. Events of other
+/// types are always kept.
+struct window_event_coalescing_info
+{
+    window_event_coalescing cursorPosition = window_event_coalescing::eKeepAll;
+    window_event_coalescing scroll = window_event_coalescing::eKeepAll;
+    window_event_coalescing size = window_event_coalescing::eKeepAll;
+    window_event_coalescing framebufferSize =
+        window_event_coalescing::eKeepAll;
+    window_event_coalescing contentScale = window_event_coalescing::eKeepAll;
+    window_event_coalescing position = window_event_coalescing::eKeepAll;
+};
+
 struct window_event_callbacks
 {
     window_key_event_callback keyCallback =
@@ -839,6 +972,178 @@ struct window_file_drop_event
     const char** paths;
 };
 
+enum struct window_event_type
+{
+    eKey,
+    eCharacter,
+    eCursorPosition,
+    eCursorEnter,
+    eMouseButton,
+    eScroll,
+    eFileDrop,
+    eClose,
+    eSize,
+    eFramebufferSize,
+    eContentScale,
+    ePosition,
+    eIconify,
+    eMaximize,
+    eFocus,
+    eRefresh
+};
+
+/// @brief A window event of any type. The member of the union that is active
+/// is determined by the type. Close and refresh events have no data.
+struct window_event
+{
+    window_event_type type;
+    event_time time;
+    union // NOLINT
+    {
+        window_key_event key;
+        window_character_event character;
+        window_cursor_position_event cursorPosition;
+        window_cursor_enter_event cursorEnter;
+        window_mouse_button_event mouseButton;
+        window_scroll_event scroll;
+        window_file_drop_event fileDrop;
+        window_size_event size;
+        window_framebuffer_size_event framebufferSize;
+        window_content_scale_event contentScale;
+        window_position_event position;
+        window_iconify_event iconify;
+        window_maximize_event maximize;
+        window_focus_event focus;
+    };
+};
+
+/// @brief Buffers for every type of window event. Passed to
+/// `window::DrainEvents` to receive events without copying them.
+struct window_events
+{
+    std::vector<window_key_event> keyEvents;
+    std::vector<window_character_event> characterEvents;
+    std::vector<window_cursor_position_event> cursorPositionEvents;
+    std::vector<window_cursor_enter_event> cursorEnterEvents;
+    std::vector<window_mouse_button_event> mouseButtonEvents;
+    std::vector<window_scroll_event> scrollEvents;
+    std::vector<window_file_drop_event> fileDropEvents;
+    size_t closeEvents = 0;
+    std::vector<window_size_event> sizeEvents;
+    std::vector<window_framebuffer_size_event> framebufferSizeEvents;
+    std::vector<window_content_scale_event> contentScaleEvents;
+    std::vector<window_position_event> positionEvents;
+    std::vector<window_iconify_event> iconifyEvents;
+    std::vector<window_maximize_event> maximizeEvents;
+    std::vector<window_focus_event> focusEvents;
+    size_t refreshEvents = 0;
+
+    /// @brief The time at which each stored event was received. Coalesced
+    /// events keep the time of the newest event.
+    std::vector<event_time> keyEventTimes;
+    std::vector<event_time> characterEventTimes;
+    std::vector<event_time> cursorPositionEventTimes;
+    std::vector<event_time> cursorEnterEventTimes;
+    std::vector<event_time> mouseButtonEventTimes;
+    std::vector<event_time> scrollEventTimes;
+    std::vector<event_time> fileDropEventTimes;
+    std::vector<event_time> closeEventTimes;
+    std::vector<event_time> sizeEventTimes;
+    std::vector<event_time> framebufferSizeEventTimes;
+    std::vector<event_time> contentScaleEventTimes;
+    std::vector<event_time> positionEventTimes;
+    std::vector<event_time> iconifyEventTimes;
+    std::vector<event_time> maximizeEventTimes;
+    std::vector<event_time> focusEventTimes;
+    std::vector<event_time> refreshEventTimes;
+
+    /// @brief Empties every buffer without releasing its memory.
+    void Clear() noexcept
+    {
+        this->keyEvents.clear();
+        this->characterEvents.clear();
+        this->cursorPositionEvents.clear();
+        this->cursorEnterEvents.clear();
+        this->mouseButtonEvents.clear();
+        this->scrollEvents.clear();
+        this->fileDropEvents.clear();
+        this->closeEvents = 0;
+        this->sizeEvents.clear();
+        this->framebufferSizeEvents.clear();
+        this->contentScaleEvents.clear();
+        this->positionEvents.clear();
+        this->iconifyEvents.clear();
+        this->maximizeEvents.clear();
+        this->focusEvents.clear();
+        this->refreshEvents = 0;
+        this->keyEventTimes.clear();
+        this->characterEventTimes.clear();
+        this->cursorPositionEventTimes.clear();
+        this->cursorEnterEventTimes.clear();
+        this->mouseButtonEventTimes.clear();
+        this->scrollEventTimes.clear();
+        this->fileDropEventTimes.clear();
+        this->closeEventTimes.clear();
+        this->sizeEventTimes.clear();
+        this->framebufferSizeEventTimes.clear();
+        this->contentScaleEventTimes.clear();
+        this->positionEventTimes.clear();
+        this->iconifyEventTimes.clear();
+        this->maximizeEventTimes.clear();
+        this->focusEventTimes.clear();
+        this->refreshEventTimes.clear();
+    }
+};
+
+/// @brief The delay between receiving input events and presenting the frames
+/// drawn after reading them.
+struct window_input_latency
+{
+    /// @brief The number of presented frames that read at least one event.
+    uint64_t frameCount = 0;
+
+    /// @brief The time from the oldest event read before a frame to the
+    /// presentation of that frame.
+    std::chrono::nanoseconds lastLatency{};
+    std::chrono::nanoseconds maxLatency{};
+    std::chrono::nanoseconds totalLatency{};
+};
+
+/// @brief The keyboard and mouse state of a window as of the last time events
+/// were polled.
+struct window_input_state
+{
+    static constexpr size_t KEY_COUNT = 512;
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    /// @brief One bit per key, set while the key is held down.
+    std::array<uint64_t, KEY_COUNT / BITS_PER_WORD> keys{};
+
+    /// @brief One bit per mouse button, set while the button is held down.
+    uint8_t mouseButtons = 0;
+
+    coordinate<double> cursorPosition = { 0, 0 };
+
+    [[nodiscard]] bool IsKeyPressed(window_key Key) const noexcept
+    {
+        auto index = static_cast<size_t>(Key);
+        if (index >= KEY_COUNT) {
+            return false;
+        }
+        return ((this->keys.at(index / BITS_PER_WORD) >>
+                 (index % BITS_PER_WORD)) &
+                1U) != 0;
+    }
+
+    [[nodiscard]] bool IsMouseButtonPressed(int Button) const noexcept
+    {
+        if (Button < 0 || Button > GLFW_MOUSE_BUTTON_LAST) {
+            return false;
+        }
+        return ((this->mouseButtons >> Button) & 1U) != 0;
+    }
+};
+
 enum struct cursor_standard_shape
 {
     // NOLINTBEGIN
@@ -898,6 +1203,10 @@ struct shader_info
     const char* code = "";
     vk::ShaderStageFlagBits stage = {};
     const char* entryPoint = "main";
+
+    /// @brief SPIR-V code that has already been mapped into memory. Takes
+    /// precedence over `code` if not nullptr.
+    file_view_ptr view = nullptr;
 };
 
 class shader
@@ -946,6 +1255,106 @@ class fragment_shader
     const char* entryPoint;
 };
 
+struct memory_allocator_statistics
+{
+    /// @brief The number of memory blocks shared by suballocations.
+    size_t blockCount = 0;
+
+    /// @brief The number of allocations that own their device memory.
+    size_t dedicatedAllocationCount = 0;
+
+    /// @brief The number of live allocations, including dedicated ones.
+    size_t allocationCount = 0;
+
+    /// @brief The total size in bytes of all device memory allocated.
+    vk::DeviceSize allocatedBytes = 0;
+
+    /// @brief The total size in bytes of all live allocations.
+    vk::DeviceSize usedBytes = 0;
+
+    /// @brief The number of free bytes within blocks.
+    vk::DeviceSize freeBytes = 0;
+
+    /// @brief The size in bytes of the largest free range within a block.
+    vk::DeviceSize largestFreeRange = 0;
+
+    /// @brief One minus the ratio of the largest free range to all free bytes.
+    /// Zero if the free memory of every block is contiguous.
+    float fragmentation = 0.0F;
+};
+
+enum struct memory_category
+{
+    eOther,
+    eVertex,
+    eStaging,
+    eImage
+};
+
+struct memory_heap_stats
+{
+    vk::DeviceSize size = 0;
+
+    /// @brief The device memory allocated by GVW from this heap.
+    vk::DeviceSize allocatedBytes = 0;
+
+    /// @brief The bytes of this heap used by live allocations.
+    vk::DeviceSize usedBytes = 0;
+
+    /// @brief The bytes this process can allocate from this heap before
+    /// allocations may fail or degrade performance. Equal to the size of the
+    /// heap without VK_EXT_memory_budget.
+    vk::DeviceSize budget = 0;
+
+    /// @brief The bytes of this heap used by this process, including memory
+    /// not allocated by GVW. Equal to allocatedBytes without
+    /// VK_EXT_memory_budget.
+    vk::DeviceSize processUsage = 0;
+};
+
+struct memory_type_stats
+{
+    uint32_t heapIndex = 0;
+    vk::DeviceSize allocatedBytes = 0;
+    vk::DeviceSize usedBytes = 0;
+};
+
+struct memory_stats
+{
+    /// @brief Whether budgets and process usage were reported by the driver
+    /// through VK_EXT_memory_budget.
+    bool budgetQueried = false;
+
+    std::vector<memory_heap_stats> heaps;
+    std::vector<memory_type_stats> types;
+
+    /// @brief Bytes used by live allocations of each category.
+    std::map<memory_category, vk::DeviceSize> categories;
+
+    /// @brief Bytes used by live allocations of each owner, such as a window.
+    std::map<const void*, vk::DeviceSize> owners;
+};
+
+struct queue_statistics
+{
+    /// @brief The number of calls to vkQueueSubmit.
+    uint64_t submitCount = 0;
+
+    /// @brief The number of submit infos submitted. Greater than submitCount
+    /// if submissions were batched.
+    uint64_t submitInfoCount = 0;
+
+    uint64_t presentCount = 0;
+
+    /// @brief The time spent within vkQueueSubmit and vkQueuePresentKHR.
+    std::chrono::nanoseconds submitTime{};
+    std::chrono::nanoseconds presentTime{};
+
+    /// @brief The time spent waiting for other threads to release the queue.
+    std::chrono::nanoseconds lockWaitTime{};
+    std::chrono::nanoseconds maxLockWaitTime{};
+};
+
 struct buffer_info
 {
     vk::DeviceSize sizeInBytes = 0;
@@ -953,6 +1362,11 @@ struct buffer_info
     vk::MemoryPropertyFlags memoryProperties =
         vk::MemoryPropertyFlagBits::eHostVisible |
         vk::MemoryPropertyFlagBits::eHostCoherent;
+
+    /// @brief The category and owner the memory of the buffer is accounted
+    /// to in memory statistics.
+    memory_category category = memory_category::eOther;
+    const void* owner = nullptr;
 };
 
 class buffer
@@ -961,8 +1375,10 @@ class buffer
 
   public:
     vk::DeviceSize size = {};
+    /// @brief Declared before the handle so that the buffer is destroyed
+    /// before its memory is returned to the allocator.
+    memory_allocation_ptr allocation;
     vk::UniqueBuffer handle;
-    vk::UniqueDeviceMemory memory;
 };
 
 struct render_pass_info
@@ -1026,7 +1442,7 @@ struct pipeline_info
     const pipeline_shaders& shaders = pipeline_shaders_config::NONE;
     const pipeline_dynamic_states& dynamicStates =
         pipeline_dynamic_states_config::VIEWPORT_AND_SCISSOR;
-    vk::RenderPass renderPass;
+    render_pass_ptr renderPass = nullptr;
 };
 
 class pipeline
@@ -1049,6 +1465,13 @@ struct device_selection_parameter
     vk::PhysicalDevice physicalDevice;
     swapchain_surface_formats surfaceFormats;
     swapchain_present_modes presentModes;
+
+    /// @brief Queried once per physical device so that selection functions do
+    /// not need to query the driver.
+    vk::PhysicalDeviceProperties properties;
+    vk::PhysicalDeviceFeatures features;
+    vk::PhysicalDeviceMemoryProperties memoryProperties;
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties;
 };
 
 struct device_selection_info
@@ -1061,6 +1484,21 @@ struct device_selection_info
     device_features physicalDeviceFeatures = device_features_config::NONE;
     const device_extensions& logicalDeviceExtensions =
         device_extensions_config::SWAPCHAIN;
+
+    /// @brief The file used to seed and persist the pipeline cache of the
+    /// selected devices. Each device uses "<pipelineCachePath>.<uuid>", or
+    /// "<pipelineCachePath>.<index>" if the UUID of its physical device is
+    /// unknown. Pipeline caches are not persisted if nullptr.
+    const char* pipelineCachePath = nullptr;
+
+    /// @brief The file used to persist the UUID of the selected physical
+    /// device. If the recorded device is present and compatible, the other
+    /// physical devices are not probed. Not persisted if nullptr.
+    const char* deviceCachePath = nullptr;
+
+    /// @brief The fraction of a memory heap budget above which the selected
+    /// devices report a warning.
+    float memoryBudgetWarningThreshold = 0.9F; // NOLINT
 };
 
 struct device_info
@@ -1074,6 +1512,14 @@ struct device_info
         device_extensions_config::SWAPCHAIN;
     device_features physicalDeviceFeatures = device_features_config::NONE;
     std::vector<device_selection_queue_family_info> queueFamilyInfos = {};
+
+    /// @brief The file used to seed and persist the pipeline cache. The
+    /// pipeline cache is not persisted if nullptr.
+    const char* pipelineCachePath = nullptr;
+
+    /// @brief The fraction of a memory heap budget above which a warning is
+    /// reported.
+    float memoryBudgetWarningThreshold = 0.9F; // NOLINT
 };
 
 struct window_info
@@ -1086,14 +1532,34 @@ struct window_info
         window_creation_hints_config::DEFAULT;
     const window_event_callbacks& eventCallbacks =
         window_event_callbacks_config::NONE;
+    const window_event_coalescing_info& eventCoalescing =
+        window_event_coalescing_info_config::KEEP_ALL;
     const device_selection_info& deviceSelectionInfo =
         device_selection_info_config::DEFAULT;
     device_ptr device = nullptr;
+
+    /// @brief If `device` is nullptr and the window has no parent, reuse a
+    /// compatible device already created by GVW instead of creating a new
+    /// one.
+    bool shareDevice = true;
+
     render_pass_ptr renderPass = nullptr;
     const pipeline_shaders& shaders = pipeline_shaders_config::NONE;
     const std::vector<gvw::xy_rgb>& staticVertices = NO_VERTICES;
     vk::DeviceSize sizeOfDynamicDataVerticesInBytes = 0;
     pipeline_ptr pipeline = nullptr;
+
+    /// @brief Defers the upload of static vertices to this batch so that the
+    /// uploads of many windows are submitted together. The batch must be
+    /// submitted before the window is drawn. If nullptr, static vertices are
+    /// uploaded before the window constructor returns.
+    upload_batch_ptr uploadBatch = nullptr;
+};
+
+struct window_frame_info
+{
+    window_ptr window = nullptr;
+    const std::vector<gvw::xy_rgb>& vertices = NO_VERTICES;
 };
 
 } // namespace gvw
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Local includes
+#include "gvw.ipp"
+#include "image_cache.hpp"
+
+namespace gvw {
+
+image_cache::image_cache(const image_cache_info& Image_Cache_Info)
+    : info(Image_Cache_Info)
+{
+}
+
+image_ptr image_cache::Find(const key& Key)
+{
+    std::scoped_lock lock(this->cacheMutex);
+    auto existingEntry = this->entries.find(Key);
+    if (existingEntry == this->entries.end()) {
+        ++this->statistics.misses;
+        return nullptr;
+    }
+    ++this->statistics.hits;
+    this->recentlyUsed.splice(this->recentlyUsed.begin(),
+                              this->recentlyUsed,
+                              existingEntry->second.recentlyUsed);
+    return existingEntry->second.image;
+}
+
+image_ptr image_cache::Insert(const key& Key, const image_ptr& Image)
+{
+    size_t imageSize = Image->GetSizeInBytes();
+
+    std::scoped_lock lock(this->cacheMutex);
+
+    // Failed decodes and images larger than the entire budget are not cached.
+    if (imageSize == 0 || imageSize > this->info.budget) {
+        return Image;
+    }
+    auto existingEntry = this->entries.find(Key);
+    if (existingEntry != this->entries.end()) {
+        return existingEntry->second.image;
+    }
+
+    auto newEntry = this->entries.emplace(Key, entry{ Image, {} }).first;
+    this->recentlyUsed.push_front(&newEntry->first);
+    newEntry->second.recentlyUsed = this->recentlyUsed.begin();
+    this->statistics.size += imageSize;
+    ++this->statistics.entries;
+    this->Trim();
+    return Image;
+}
+
+void image_cache::Trim()
+{
+    while (this->statistics.size > this->info.budget &&
+           !this->recentlyUsed.empty()) {
+        auto leastRecentlyUsed = this->entries.find(*this->recentlyUsed.back());
+        this->statistics.size -=
+            leastRecentlyUsed->second.image->GetSizeInBytes();
+        --this->statistics.entries;
+        ++this->statistics.evictions;
+        this->entries.erase(leastRecentlyUsed);
+        this->recentlyUsed.pop_back();
+    }
+}
+
+template<typename T>
+image_ptr image_cache::Load(const key& Key, const T& Info)
+{
+    image_ptr cachedImage = this->Find(Key);
+    if (cachedImage != nullptr) {
+        return cachedImage;
+    }
+
+    // Decode without holding the lock so that other images can be loaded
+    // concurrently.
+    return this->Insert(Key, CreateImage(Info));
+}
+
+image_ptr image_cache::Load(const image_file_info& File_Info)
+{
+    if (File_Info.path == nullptr) {
+        return CreateImage(File_Info);
+    }
+
+    std::error_code errorCode;
+    auto lastWriteTime =
+        std::filesystem::last_write_time(File_Info.path, errorCode);
+    if (errorCode) {
+        // Let the image constructor report the error.
+        return CreateImage(File_Info);
+    }
+
+    key fileKey;
+    fileKey.path = File_Info.path;
+    fileKey.lastWriteTime = lastWriteTime;
+    fileKey.requestedColorComponentsPerPixel =
+        File_Info.requestedColorComponentsPerPixel;
+    return this->Load(fileKey, File_Info);
+}
+
+image_ptr image_cache::Load(const image_memory_info& Memory_Info)
+{
+    key memoryKey;
+    memoryKey.contentHash =
+        internal::Fnv1a64(Memory_Info.data.data(), Memory_Info.data.size());
+    memoryKey.content = Memory_Info.data;
+    memoryKey.requestedColorComponentsPerPixel =
+        Memory_Info.requestedColorComponentsPerPixel;
+    return this->Load(memoryKey, Memory_Info);
+}
+
+image_cache_statistics image_cache::GetStatistics() const
+{
+    std::scoped_lock lock(this->cacheMutex);
+    return this->statistics;
+}
+
+void image_cache::SetBudget(size_t Budget)
+{
+    std::scoped_lock lock(this->cacheMutex);
+    this->info.budget = Budget;
+    this->Trim();
+}
+
+void image_cache::Clear()
+{
+    std::scoped_lock lock(this->cacheMutex);
+    this->entries.clear();
+    this->recentlyUsed.clear();
+    this->statistics.size = 0;
+    this->statistics.entries = 0;
+}
+
+image_cache_ptr CreateImageCache(const image_cache_info& Image_Cache_Info)
+{
+    return std::make_shared<internal::image_cache_public_constructor>(
+        Image_Cache_Info);
+}
+
+} // namespace gvw
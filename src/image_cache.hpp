@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file image_cache.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Least recently used cache of decoded images.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <filesystem>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief Decodes each distinct image once and shares the result.
+/// @remark Files are identified by path and modification time, so a modified
+/// file is decoded again. Memory is identified by its contents, which are
+/// compared by hash first.
+class image_cache : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::image_cache_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Initializes the image cache object.
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    image_cache(const image_cache_info& Image_Cache_Info);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~image_cache() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                            Private Types                             ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    struct key
+    {
+        std::string path;
+        std::filesystem::file_time_type lastWriteTime;
+        // The hash is compared before the contents so that distinct images
+        // rarely need their contents compared.
+        uint64_t contentHash = 0;
+        std::vector<uint8_t> content;
+        int requestedColorComponentsPerPixel = 0;
+
+        auto operator<=>(const key&) const = default;
+    };
+
+    struct entry
+    {
+        image_ptr image;
+        std::list<const key*>::iterator recentlyUsed;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    image_cache_info info;
+
+    std::map<key, entry> entries;
+
+    /// @brief Keys of the entries ordered from most to least recently used.
+    std::list<const key*> recentlyUsed;
+
+    image_cache_statistics statistics;
+
+    mutable std::mutex cacheMutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns a cached image and marks it as most recently used, or
+    /// returns nullptr on a miss.
+    [[nodiscard]] image_ptr Find(const key& Key);
+
+    /// @brief Caches a decoded image and evicts the least recently used images
+    /// until the cache fits within its budget. Returns the cached image, which
+    /// differs from the given image if another thread cached the same key
+    /// first.
+    [[nodiscard]] image_ptr Insert(const key& Key, const image_ptr& Image);
+
+    /// @brief Evicts the least recently used images until the cache fits
+    /// within its budget.
+    /// @warning The cache mutex must be locked.
+    void Trim();
+
+    template<typename T>
+    [[nodiscard]] image_ptr Load(const key& Key, const T& Info);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the cached image for a file, decoding it on a miss.
+    [[nodiscard]] image_ptr Load(const image_file_info& File_Info);
+
+    /// @brief Returns the cached image for encoded image data, decoding it on a
+    /// miss.
+    [[nodiscard]] image_ptr Load(const image_memory_info& Memory_Info);
+
+    /// @brief Returns the hit, miss, and eviction counters and the current
+    /// contents of the cache.
+    [[nodiscard]] image_cache_statistics GetStatistics() const;
+
+    /// @brief Changes the byte budget, evicting images if necessary.
+    void SetBudget(size_t Budget);
+
+    /// @brief Removes all images from the cache. Images still referenced
+    /// elsewhere remain valid.
+    void Clear();
+};
+
+} // namespace gvw
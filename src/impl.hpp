@@ -22,6 +22,9 @@ struct instance::impl
     vk::DispatchLoaderDynamic vulkanDispatchLoaderDynamic;
     vk::UniqueHandle<vk::DebugUtilsMessengerEXT, vk::DispatchLoaderDynamic>
         vulkanDebugUtilsMessenger;
+
+    /// @brief The Vulkan version requested by the application.
+    uint32_t vulkanApiVersion = VK_API_VERSION_1_0;
 };
 
 } // namespace gvw
\ No newline at end of file
@@ -1,6 +1,14 @@
 // Standard includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <numeric>
+#include <map>
+#include <thread>
 
 // Local includes
 #include "gvw.hpp"
@@ -11,6 +19,8 @@
 #include "monitor.hpp"
 #include "window.hpp"
 #include "device.hpp"
+#include "upload_batch.hpp"
+#include "queue.hpp"
 #include "impl.hpp"
 
 namespace gvw {
@@ -92,6 +102,7 @@ instance::instance(const instance_info& Instance_Info)
         // Initialize the GLFW library.
         if (glfwInit() == GLFW_TRUE) {
             this->initializedGlfw = true;
+            internal::global::MAIN_THREAD_ID = std::this_thread::get_id();
         } else {
             ErrorCallback("GLFW failed to initialize");
         }
@@ -257,7 +268,8 @@ instance::instance(const instance_info& Instance_Info)
         std::move(instanceLayers),
         std::move(instance),
         dispatchLoaderDynamic,
-        std::move(debugUtilsMessenger));
+        std::move(debugUtilsMessenger),
+        Instance_Info.applicationInfo.apiVersion);
 }
 
 void instance::TerminateGlfw()
@@ -284,7 +296,10 @@ void instance::PollEvents()
         return;
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    internal::RunMainThreadTasks();
     glfwPollEvents();
+    internal::RunMainThreadTasks();
+    this->FinishPolledWindows();
 }
 
 void instance::WaitThenPollEvents()
@@ -293,7 +308,10 @@ void instance::WaitThenPollEvents()
         return;
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    internal::RunMainThreadTasks();
     glfwWaitEvents();
+    internal::RunMainThreadTasks();
+    this->FinishPolledWindows();
 }
 
 void instance::WaitThenPollEvents(double Timeout)
@@ -302,7 +320,10 @@ void instance::WaitThenPollEvents(double Timeout)
         return;
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    internal::RunMainThreadTasks();
     glfwWaitEventsTimeout(Timeout);
+    internal::RunMainThreadTasks();
+    this->FinishPolledWindows();
 }
 
 void instance::PostEmptyEvent()
@@ -329,6 +350,257 @@ window_ptr instance::CreateWindow(const window_info& Window_Info)
     return std::make_shared<internal::window_public_constructor>(Window_Info);
 }
 
+std::vector<window_ptr> instance::CreateWindows(
+    std::span<const window_info> Window_Infos)
+{
+    if (this->GlfwNotInitialized(static_cast<const char*>(__func__)) ||
+        this->VulkanNotSupported(static_cast<const char*>(__func__)) ||
+        this->RequiredExtensionsNotSupported(
+            static_cast<const char*>(__func__)) ||
+        this->SelectedExtensionsNotSupported(
+            static_cast<const char*>(__func__)) ||
+        this->SelectedLayersNotSupported(static_cast<const char*>(__func__))) {
+        return {};
+    }
+
+    // GLFW windows may only be created on the main thread.
+    std::vector<window_ptr> windows;
+    windows.reserve(Window_Infos.size());
+    for (const auto& windowInfo : Window_Infos) {
+        windows.emplace_back(
+            std::make_shared<internal::window_public_constructor>(
+                windowInfo, nullptr, false));
+    }
+
+    // The first window created with each device selection info selects a
+    // device for the windows after it.
+    std::map<const device_selection_info*, window*> deviceOwners;
+    std::vector<window*> parentWindows(windows.size(), nullptr);
+    for (size_t i = 0; i < windows.size(); ++i) {
+        const window_info& windowInfo = Window_Infos[i];
+        if (!windows.at(i)->surface || windowInfo.device != nullptr) {
+            continue;
+        }
+        if (windowInfo.shareDevice) {
+            auto [deviceOwner, inserted] = deviceOwners.try_emplace(
+                &windowInfo.deviceSelectionInfo, windows.at(i).get());
+            if (!inserted) {
+                parentWindows.at(i) = deviceOwner->second;
+                continue;
+            }
+        }
+        windows.at(i)->CreateVulkanObjects(windowInfo, nullptr, nullptr);
+    }
+
+    // Create the device objects of the remaining windows in parallel and
+    // batch their uploads per device.
+    struct window_creation
+    {
+        const window_info* windowInfo;
+        window* createdWindow;
+        window* parentWindow;
+        upload_batch_ptr uploadBatch;
+    };
+    std::map<device*, upload_batch_ptr> uploadBatches;
+    std::vector<window_creation> creations;
+    for (size_t i = 0; i < windows.size(); ++i) {
+        const window_info& windowInfo = Window_Infos[i];
+        window* parentWindow = parentWindows.at(i);
+        if (!windows.at(i)->surface ||
+            (windowInfo.device == nullptr && parentWindow == nullptr)) {
+            continue;
+        }
+        const device_ptr& windowDevice = (windowInfo.device != nullptr)
+                                             ? windowInfo.device
+                                             : parentWindow->logicalDevice;
+        if (windowDevice == nullptr) {
+            ErrorCallback("Failed to create the device objects of a window. "
+                          "The window it shares a device with has no "
+                          "device.");
+            continue;
+        }
+        upload_batch_ptr& uploadBatch = uploadBatches[windowDevice.get()];
+        if (uploadBatch == nullptr) {
+            uploadBatch = windowDevice->BeginUploadBatch();
+        }
+        creations.push_back({ .windowInfo = &windowInfo,
+                              .createdWindow = windows.at(i).get(),
+                              .parentWindow = parentWindow,
+                              .uploadBatch = uploadBatch });
+    }
+
+    // Creating a pipeline may wait on a build queued on the thread pool, so
+    // the windows are created by a bounded set of threads outside of it.
+    std::atomic<size_t> nextCreation = 0;
+    std::vector<std::exception_ptr> creationErrors(creations.size());
+    auto createWindows = [&]() {
+        for (size_t i = nextCreation++; i < creations.size();
+             i = nextCreation++) {
+            const window_creation& creation = creations.at(i);
+            try {
+                creation.createdWindow->CreateVulkanObjects(
+                    *creation.windowInfo,
+                    creation.parentWindow,
+                    creation.uploadBatch);
+            } catch (...) {
+                creationErrors.at(i) = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> creationThreads;
+    size_t creationThreadCount = std::min(
+        internal::thread_pool::GetThreadCount(), creations.size());
+    for (size_t i = 1; i < creationThreadCount; ++i) {
+        creationThreads.emplace_back(createWindows);
+    }
+    createWindows();
+    for (auto& creationThread : creationThreads) {
+        creationThread.join();
+    }
+
+    // Every window is created before rethrowing errors so that no thread
+    // outlives the window infos.
+    for (const auto& creationError : creationErrors) {
+        if (creationError) {
+            std::rethrow_exception(creationError);
+        }
+    }
+    for (const auto& [windowDevice, uploadBatch] : uploadBatches) {
+        uploadBatch->Submit();
+    }
+
+    return windows;
+}
+
+void instance::DrawFrames(std::span<const window_frame_info> Frames)
+{
+    // Wait for the previous frames of every window with one call per device.
+    std::map<device*, std::vector<vk::Fence>> previousFences;
+    for (const auto& frame : Frames) {
+        const window& frameWindow = *frame.window;
+        std::vector<vk::Fence>& deviceFences =
+            previousFences[frameWindow.logicalDevice.get()];
+        vk::Fence previousFence =
+            frameWindow.inFlightFences.at(frameWindow.currentFrameIndex)
+                ->get();
+        if (std::find(deviceFences.begin(),
+                      deviceFences.end(),
+                      previousFence) == deviceFences.end()) {
+            deviceFences.push_back(previousFence);
+        }
+    }
+    for (const auto& [frameDevice, fences] : previousFences) {
+        if (frameDevice->GetHandle().waitForFences(
+                fences, VK_TRUE, UINT64_MAX) != vk::Result::eSuccess) {
+            ErrorCallback("Failed to wait for the previous frames to finish "
+                          "rendering.");
+        }
+    }
+
+    // Record the frame of every window that acquired a swapchain image.
+    struct frame_submission
+    {
+        queue_ptr graphicsQueue;
+        std::vector<window*> windows;
+        std::vector<vk::SubmitInfo> submitInfos;
+    };
+    std::map<queue*, frame_submission> submissions;
+    for (const auto& frame : Frames) {
+        window& frameWindow = *frame.window;
+        std::optional<uint32_t> imageIndex = frameWindow.AcquireFrameImage();
+        if (!imageIndex.has_value()) {
+            continue;
+        }
+        frameWindow.RecordFrame(imageIndex.value(), frame.vertices);
+
+        frame_submission& submission =
+            submissions[frameWindow.graphicsQueue.get()];
+        submission.graphicsQueue = frameWindow.graphicsQueue;
+        submission.windows.push_back(&frameWindow);
+        submission.submitInfos.push_back(frameWindow.GetFrameSubmitInfo());
+    }
+
+    // Submit the frames of each graphics queue at once. vkQueueSubmit signals
+    // a single fence, so the windows of a submission share it.
+    for (auto& [graphicsQueue, submission] : submissions) {
+        const window& firstWindow = *submission.windows.front();
+        const std::shared_ptr<vk::UniqueFence>& previousFence =
+            firstWindow.inFlightFences.at(firstWindow.currentFrameIndex);
+        bool fenceIsReusable =
+            std::all_of(submission.windows.begin(),
+                        submission.windows.end(),
+                        [&](const window* Window) {
+                            return Window->inFlightFences
+                                       .at(Window->currentFrameIndex)
+                                       .get() == previousFence.get();
+                        }) &&
+            (size_t(previousFence.use_count()) == submission.windows.size());
+
+        vk::Device deviceHandle = firstWindow.logicalDevice->GetHandle();
+        std::shared_ptr<vk::UniqueFence> fence;
+        if (fenceIsReusable) {
+            fence = previousFence;
+            deviceHandle.resetFences(fence->get());
+        } else {
+            fence = std::make_shared<vk::UniqueFence>(
+                deviceHandle.createFenceUnique({}));
+        }
+        for (window* submittedWindow : submission.windows) {
+            submittedWindow->inFlightFences.at(
+                submittedWindow->currentFrameIndex) = fence;
+        }
+
+        submission.graphicsQueue->Submit(submission.submitInfos, fence->get());
+    }
+
+    // Present the swapchains of each presentation queue at once.
+    struct frame_presentation
+    {
+        queue_ptr presentQueue;
+        std::vector<window*> windows;
+        std::vector<vk::Semaphore> waitSemaphores;
+        std::vector<vk::SwapchainKHR> swapchains;
+        std::vector<uint32_t> imageIndices;
+    };
+    std::map<queue*, frame_presentation> presentations;
+    for (const auto& [graphicsQueue, submission] : submissions) {
+        for (window* submittedWindow : submission.windows) {
+            frame_presentation& presentation =
+                presentations[submittedWindow->presentQueue.get()];
+            presentation.presentQueue = submittedWindow->presentQueue;
+            presentation.windows.push_back(submittedWindow);
+            presentation.waitSemaphores.push_back(
+                submittedWindow->finishedRenderingSemaphores
+                    .at(submittedWindow->currentFrameIndex)
+                    .get());
+            presentation.swapchains.push_back(
+                submittedWindow->swapchain->handle.get());
+            presentation.imageIndices.push_back(
+                submittedWindow->frameImageIndex);
+        }
+    }
+    for (auto& [presentQueue, presentation] : presentations) {
+        std::vector<vk::Result> presentResults(presentation.windows.size(),
+                                               vk::Result::eSuccess);
+        vk::PresentInfoKHR presentInfo = {
+            .waitSemaphoreCount =
+                static_cast<uint32_t>(presentation.waitSemaphores.size()),
+            .pWaitSemaphores = presentation.waitSemaphores.data(),
+            .swapchainCount =
+                static_cast<uint32_t>(presentation.swapchains.size()),
+            .pSwapchains = presentation.swapchains.data(),
+            .pImageIndices = presentation.imageIndices.data(),
+            .pResults = presentResults.data()
+        };
+        static_cast<void>(presentation.presentQueue->Present(presentInfo));
+
+        // Each swapchain reports its own result.
+        for (size_t i = 0; i < presentation.windows.size(); ++i) {
+            presentation.windows.at(i)->EndFrame(presentResults.at(i));
+        }
+    }
+}
+
 std::vector<device_ptr> instance::SelectPhysicalDevices(
     const device_selection_info& Device_Info,
     const vk::SurfaceKHR* Window_Surface)
@@ -342,30 +614,214 @@ std::vector<device_ptr> instance::SelectPhysicalDevices(
         return {};
     }
 
-    std::vector<vk::PhysicalDevice> physicalDevices =
-        this->pImpl->vulkanInstance->enumeratePhysicalDevices();
+    std::vector<physical_device_cache_entry> physicalDevices =
+        this->GetPhysicalDevices();
     if (physicalDevices.empty()) {
         ErrorCallback("No physical devices with Vulkan support are available.");
+        return {};
     }
 
-    std::vector<vk::SurfaceFormatKHR> selectedSurfaceFormats =
-        Device_Info.surfaceFormats;
-    std::vector<vk::PresentModeKHR> selectedPresentModes =
-        Device_Info.presentModes;
+    // Probe the physical device selected during a previous run before probing
+    // all of them.
+    std::vector<device_info> selectedPhysicalDevicesInfo;
+    std::optional<device_uuid> previousDeviceUuid =
+        LoadSelectedDeviceUuid(Device_Info.deviceCachePath);
+    auto previousDevice = std::find_if(
+        physicalDevices.begin(),
+        physicalDevices.end(),
+        [&](const physical_device_cache_entry& Physical_Device) {
+            return previousDeviceUuid.has_value() &&
+                   Physical_Device.uuid == previousDeviceUuid;
+        });
+    if (previousDevice != physicalDevices.end()) {
+        std::vector<device_selection_parameter> compatiblePhysicalDevices =
+            this->GetCompatiblePhysicalDevices(
+                { &*previousDevice, 1 }, Device_Info, *Window_Surface);
+        if (!compatiblePhysicalDevices.empty()) {
+            selectedPhysicalDevicesInfo =
+                Device_Info.selectPhysicalDevicesAndQueues(
+                    compatiblePhysicalDevices, *Window_Surface);
+        }
+    }
 
+    if (selectedPhysicalDevicesInfo.empty()) {
+        std::vector<device_selection_parameter> compatiblePhysicalDevices =
+            this->GetCompatiblePhysicalDevices(
+                physicalDevices, Device_Info, *Window_Surface);
+        if (compatiblePhysicalDevices.empty()) {
+            ErrorCallback("No physical devices support a selected surface "
+                          "format and/or present mode.");
+            return {};
+        }
+
+        /// @todo Remove std::optional from this function.
+        selectedPhysicalDevicesInfo =
+            Device_Info.selectPhysicalDevicesAndQueues(
+                compatiblePhysicalDevices, *Window_Surface);
+        if (selectedPhysicalDevicesInfo.empty()) {
+            ErrorCallback("No physical devices were selected.");
+            return {};
+        }
+    }
+
+    if (Device_Info.deviceCachePath != nullptr) {
+        auto selectedDevice = std::find_if(
+            physicalDevices.begin(),
+            physicalDevices.end(),
+            [&](const physical_device_cache_entry& Physical_Device) {
+                return Physical_Device.parameter.physicalDevice ==
+                       selectedPhysicalDevicesInfo.at(0).physicalDevice;
+            });
+        if (selectedDevice != physicalDevices.end() &&
+            selectedDevice->uuid.has_value() &&
+            selectedDevice->uuid != previousDeviceUuid) {
+            SaveSelectedDeviceUuid(Device_Info.deviceCachePath,
+                                   selectedDevice->uuid.value());
+        }
+    }
+
+    std::vector<device_ptr> logicalDevices;
+    logicalDevices.reserve(selectedPhysicalDevicesInfo.size());
+
+    for (auto& physicalDeviceInfo : selectedPhysicalDevicesInfo) {
+        physicalDeviceInfo.logicalDeviceExtensions =
+            Device_Info.logicalDeviceExtensions;
+        physicalDeviceInfo.physicalDeviceFeatures =
+            Device_Info.physicalDeviceFeatures;
+        physicalDeviceInfo.memoryBudgetWarningThreshold =
+            Device_Info.memoryBudgetWarningThreshold;
+
+        // Each device persists its own pipeline cache so that devices do not
+        // overwrite each other's.
+        std::string pipelineCachePath;
+        if (Device_Info.pipelineCachePath != nullptr) {
+            pipelineCachePath =
+                GetDevicePipelineCachePath(Device_Info.pipelineCachePath,
+                                           physicalDevices,
+                                           physicalDeviceInfo.physicalDevice);
+            physicalDeviceInfo.pipelineCachePath = pipelineCachePath.c_str();
+        }
+
+        logicalDevices.emplace_back(
+            std::make_shared<internal::device_public_constructor>(
+                physicalDeviceInfo));
+    }
+
+    {
+        std::scoped_lock lock(this->deviceRegistryMutex);
+        std::erase_if(this->deviceRegistry,
+                      [](const std::weak_ptr<device>& Device) {
+                          return Device.expired();
+                      });
+        this->deviceRegistry.insert(this->deviceRegistry.end(),
+                                    logicalDevices.begin(),
+                                    logicalDevices.end());
+    }
+
+    return logicalDevices;
+}
+
+device_ptr instance::GetSharedDevice(const device_selection_info& Device_Info,
+                                     vk::SurfaceKHR Window_Surface)
+{
+    std::scoped_lock lock(this->sharedDeviceMutex);
+    for (const auto& logicalDevice : this->GetDevices()) {
+        if (logicalDevice->IsCompatible(Device_Info, Window_Surface)) {
+            return logicalDevice;
+        }
+    }
+
+    std::vector<device_ptr> logicalDevices =
+        this->SelectPhysicalDevices(Device_Info, &Window_Surface);
+    if (logicalDevices.empty()) {
+        return nullptr;
+    }
+    return logicalDevices.at(0);
+}
+
+std::vector<instance::physical_device_cache_entry> instance::
+    GetPhysicalDevices()
+{
+    std::scoped_lock lock(this->deviceCacheMutex);
+    if (this->physicalDeviceCache.has_value()) {
+        return this->physicalDeviceCache.value();
+    }
+
+    std::vector<physical_device_cache_entry> physicalDevices;
+    for (const auto& physicalDevice :
+         this->pImpl->vulkanInstance->enumeratePhysicalDevices()) {
+        physical_device_cache_entry entry = {
+            .parameter = { .physicalDevice = physicalDevice,
+                           .properties = physicalDevice.getProperties(),
+                           .features = physicalDevice.getFeatures(),
+                           .memoryProperties =
+                               physicalDevice.getMemoryProperties(),
+                           .queueFamilyProperties =
+                               physicalDevice.getQueueFamilyProperties() }
+        };
+
+        // Device UUIDs are queried with vkGetPhysicalDeviceProperties2, which
+        // requires Vulkan 1.1.
+        if (this->pImpl->vulkanApiVersion >= VK_API_VERSION_1_1 &&
+            entry.parameter.properties.apiVersion >= VK_API_VERSION_1_1) {
+            auto propertiesChain =
+                physicalDevice.getProperties2<vk::PhysicalDeviceProperties2,
+                                              vk::PhysicalDeviceIDProperties>();
+            const auto& idProperties =
+                propertiesChain.get<vk::PhysicalDeviceIDProperties>();
+            device_uuid uuid = {};
+            std::copy(idProperties.deviceUUID.begin(),
+                      idProperties.deviceUUID.end(),
+                      uuid.begin());
+            entry.uuid = uuid;
+        }
+
+        physicalDevices.emplace_back(std::move(entry));
+    }
+    this->physicalDeviceCache = physicalDevices;
+    return physicalDevices;
+}
+
+instance::surface_capabilities instance::GetSurfaceCapabilities(
+    vk::PhysicalDevice Physical_Device,
+    vk::SurfaceKHR Surface)
+{
+    std::scoped_lock lock(this->deviceCacheMutex);
+    auto [capabilities, inserted] =
+        this->surfaceCapabilityCache.try_emplace({ Physical_Device, Surface });
+    if (inserted) {
+        try {
+            capabilities->second = {
+                .surfaceFormats = Physical_Device.getSurfaceFormatsKHR(Surface),
+                .presentModes =
+                    Physical_Device.getSurfacePresentModesKHR(Surface)
+            };
+        } catch (...) {
+            this->surfaceCapabilityCache.erase(capabilities);
+            throw;
+        }
+    }
+    return capabilities->second;
+}
+
+std::vector<device_selection_parameter> instance::GetCompatiblePhysicalDevices(
+    std::span<const physical_device_cache_entry> Physical_Devices,
+    const device_selection_info& Device_Info,
+    vk::SurfaceKHR Window_Surface)
+{
     std::vector<device_selection_parameter> compatiblePhysicalDevices;
-    for (const auto& physicalDevice : physicalDevices) {
+    for (const auto& physicalDevice : Physical_Devices) {
+        surface_capabilities capabilities = this->GetSurfaceCapabilities(
+            physicalDevice.parameter.physicalDevice, Window_Surface);
 
-        std::vector<vk::SurfaceFormatKHR> availableSurfaceFormats =
-            physicalDevice.getSurfaceFormatsKHR(*Window_Surface);
-        if (availableSurfaceFormats.empty()) {
+        if (capabilities.surfaceFormats.empty()) {
             /// @todo Log this.
             continue;
         }
         std::vector<vk::SurfaceFormatKHR> viableSurfaceFormats =
             internal::GetCommonElementsInArr1(
-                selectedSurfaceFormats,
-                availableSurfaceFormats,
+                Device_Info.surfaceFormats,
+                capabilities.surfaceFormats,
                 [](const vk::SurfaceFormatKHR& Lhs,
                    const vk::SurfaceFormatKHR& Rhs) { return Lhs == Rhs; });
         if (viableSurfaceFormats.empty()) {
@@ -373,16 +829,14 @@ std::vector<device_ptr> instance::SelectPhysicalDevices(
             continue;
         }
 
-        std::vector<vk::PresentModeKHR> availablePresentModes =
-            physicalDevice.getSurfacePresentModesKHR(*Window_Surface);
-        if (availablePresentModes.empty()) {
+        if (capabilities.presentModes.empty()) {
             /// @todo Log this.
             continue;
         }
         std::vector<vk::PresentModeKHR> viablePresentModes =
             internal::GetCommonElementsInArr1(
-                selectedPresentModes,
-                availablePresentModes,
+                Device_Info.presentModes,
+                capabilities.presentModes,
                 [](const vk::PresentModeKHR& Lhs,
                    const vk::PresentModeKHR& Rhs) { return Lhs == Rhs; });
         if (viablePresentModes.empty()) {
@@ -390,38 +844,111 @@ std::vector<device_ptr> instance::SelectPhysicalDevices(
             continue;
         }
 
-        compatiblePhysicalDevices.emplace_back(
-            physicalDevice, viableSurfaceFormats, viablePresentModes);
+        device_selection_parameter& parameter =
+            compatiblePhysicalDevices.emplace_back(physicalDevice.parameter);
+        parameter.surfaceFormats = std::move(viableSurfaceFormats);
+        parameter.presentModes = std::move(viablePresentModes);
     }
-    if (compatiblePhysicalDevices.empty()) {
-        ErrorCallback("No physical devices support a selected surface format "
-                      "and/or present mode.");
-        return {};
+    return compatiblePhysicalDevices;
+}
+
+std::optional<instance::device_uuid> instance::LoadSelectedDeviceUuid(
+    const char* Path)
+{
+    if (Path == nullptr) {
+        return std::nullopt;
+    }
+    std::ifstream file(Path, std::ios::binary);
+    if (!file.is_open()) {
+        // No physical device has been selected yet.
+        return std::nullopt;
+    }
+    device_uuid uuid = {};
+    file.read(reinterpret_cast<char*>(uuid.data()), // NOLINT
+              static_cast<std::streamsize>(uuid.size()));
+    if (file.fail()) {
+        return std::nullopt;
     }
+    return uuid;
+}
 
-    /// @todo Remove std::optional from this function.
-    std::vector<device_info> selectedPhysicalDevicesInfo =
-        Device_Info.selectPhysicalDevicesAndQueues(compatiblePhysicalDevices,
-                                                   *Window_Surface);
-    if (selectedPhysicalDevicesInfo.empty()) {
-        ErrorCallback("No physical devices were selected.");
-        return {};
+void instance::SaveSelectedDeviceUuid(const char* Path, const device_uuid& Uuid)
+{
+    std::ofstream file(Path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(Uuid.data()), // NOLINT
+               static_cast<std::streamsize>(Uuid.size()));
+    if (file.fail()) {
+        WarningCallback("Failed to save the selected physical device.");
     }
+}
 
-    std::vector<device_ptr> logicalDevices;
-    logicalDevices.reserve(selectedPhysicalDevicesInfo.size());
+std::string instance::GetDevicePipelineCachePath(
+    const char* Path,
+    std::span<const physical_device_cache_entry> Physical_Devices,
+    vk::PhysicalDevice Physical_Device)
+{
+    auto physicalDevice = std::find_if(
+        Physical_Devices.begin(),
+        Physical_Devices.end(),
+        [&](const physical_device_cache_entry& Cached_Physical_Device) {
+            return Cached_Physical_Device.parameter.physicalDevice ==
+                   Physical_Device;
+        });
 
-    for (auto& physicalDeviceInfo : selectedPhysicalDevicesInfo) {
-        physicalDeviceInfo.logicalDeviceExtensions =
-            Device_Info.logicalDeviceExtensions;
-        physicalDeviceInfo.physicalDeviceFeatures =
-            Device_Info.physicalDeviceFeatures;
+    // Identify the physical device by its UUID if it is available, or by its
+    // position among the enumerated physical devices otherwise.
+    std::ostringstream devicePath;
+    devicePath << Path << '.';
+    if (physicalDevice != Physical_Devices.end() &&
+        physicalDevice->uuid.has_value()) {
+        devicePath << std::hex << std::setfill('0');
+        for (uint8_t byte : physicalDevice->uuid.value()) {
+            devicePath << std::setw(2) << static_cast<unsigned>(byte);
+        }
+    } else {
+        devicePath << std::distance(Physical_Devices.begin(), physicalDevice);
+    }
+    return devicePath.str();
+}
 
-        logicalDevices.emplace_back(
-            std::make_shared<internal::device_public_constructor>(
-                physicalDeviceInfo));
+void instance::ForgetSurface(vk::SurfaceKHR Surface)
+{
+    std::scoped_lock lock(this->deviceCacheMutex);
+    std::erase_if(this->surfaceCapabilityCache, [&](const auto& Capabilities) {
+        return Capabilities.first.second == Surface;
+    });
+}
+
+void instance::FinishPolledWindows()
+{
+    for (window* polledWindow : this->windowsAwaitingPollEnd) {
+        polledWindow->FinishPoll();
     }
+    this->windowsAwaitingPollEnd.clear();
+}
 
+void instance::ForgetWindow(window* Window)
+{
+    std::erase(this->windowsAwaitingPollEnd, Window);
+}
+
+void instance::InvalidateDeviceCache()
+{
+    std::scoped_lock lock(this->deviceCacheMutex);
+    this->physicalDeviceCache.reset();
+    this->surfaceCapabilityCache.clear();
+}
+
+std::vector<device_ptr> instance::GetDevices()
+{
+    std::scoped_lock lock(this->deviceRegistryMutex);
+    std::vector<device_ptr> logicalDevices;
+    logicalDevices.reserve(this->deviceRegistry.size());
+    for (const auto& registeredDevice : this->deviceRegistry) {
+        if (device_ptr logicalDevice = registeredDevice.lock()) {
+            logicalDevices.emplace_back(std::move(logicalDevice));
+        }
+    }
     return logicalDevices;
 }
 
@@ -8,7 +8,12 @@
  */
 
 // Standard includes
+#include <array>
 #include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
 
 // Local includes
 #include "gvw.hpp"
@@ -48,6 +53,27 @@ class instance : internal::uncopyable_unmovable // NOLINT
     ~instance() = default;
 
   private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                            Private Types                             ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    using device_uuid = std::array<uint8_t, VK_UUID_SIZE>;
+
+    /// @brief The surface independent capabilities of a physical device.
+    struct physical_device_cache_entry
+    {
+        device_selection_parameter parameter;
+
+        /// @brief Only available with Vulkan 1.1 or later.
+        std::optional<device_uuid> uuid;
+    };
+
+    struct surface_capabilities
+    {
+        swapchain_surface_formats surfaceFormats;
+        swapchain_present_modes presentModes;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     ///                           Private Variables                          ///
     ////////////////////////////////////////////////////////////////////////////
@@ -61,6 +87,31 @@ class instance : internal::uncopyable_unmovable // NOLINT
     bool selectedExtensionsSupported = false;
     bool selectedLayersSupported = false;
 
+    /// @brief Every logical device created by this instance. Devices are
+    /// destroyed once the last window or user reference to them is released.
+    std::vector<std::weak_ptr<device>> deviceRegistry;
+    std::mutex deviceRegistryMutex;
+
+    /// @brief Serializes `GetSharedDevice` so that concurrent callers do not
+    /// each create a device.
+    std::mutex sharedDeviceMutex;
+
+    /// @brief Physical devices enumerated by this instance. Enumerated again
+    /// only after `InvalidateDeviceCache` is called.
+    std::optional<std::vector<physical_device_cache_entry>> physicalDeviceCache;
+
+    /// @brief The formats and present modes each physical device supports for
+    /// each surface.
+    std::map<std::pair<vk::PhysicalDevice, vk::SurfaceKHR>,
+             surface_capabilities>
+        surfaceCapabilityCache;
+
+    std::mutex deviceCacheMutex;
+
+    /// @brief Windows with coalesced events or input state to publish once
+    /// events have been polled. Guarded by the GLFW mutex.
+    std::vector<window*> windowsAwaitingPollEnd;
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     ///                        Public Static Functions                       ///
@@ -85,6 +136,50 @@ class instance : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] bool SelectedLayersNotSupported(
         const std::string& Function_Name) const;
 
+    /// @brief Returns the cached physical devices, enumerating them first if
+    /// necessary.
+    [[nodiscard]] std::vector<physical_device_cache_entry>
+    GetPhysicalDevices();
+
+    /// @brief Returns the cached capabilities of a physical device for a
+    /// surface, querying them first if necessary.
+    [[nodiscard]] surface_capabilities GetSurfaceCapabilities(
+        vk::PhysicalDevice Physical_Device,
+        vk::SurfaceKHR Surface);
+
+    /// @brief Returns the physical devices that support one of the selected
+    /// surface formats and present modes, with the viable ones filled in.
+    [[nodiscard]] std::vector<device_selection_parameter>
+    GetCompatiblePhysicalDevices(
+        std::span<const physical_device_cache_entry> Physical_Devices,
+        const device_selection_info& Device_Info,
+        vk::SurfaceKHR Window_Surface);
+
+    [[nodiscard]] static std::optional<device_uuid> LoadSelectedDeviceUuid(
+        const char* Path);
+    static void SaveSelectedDeviceUuid(const char* Path,
+                                       const device_uuid& Uuid);
+
+    /// @brief Returns the pipeline cache path of a physical device, made
+    /// unique by appending the UUID or the index of the physical device.
+    [[nodiscard]] static std::string GetDevicePipelineCachePath(
+        const char* Path,
+        std::span<const physical_device_cache_entry> Physical_Devices,
+        vk::PhysicalDevice Physical_Device);
+
+    /// @brief Forgets the cached capabilities of every physical device for a
+    /// surface that is about to be destroyed.
+    void ForgetSurface(vk::SurfaceKHR Surface);
+
+    /// @brief Pushes the coalesced events and publishes the input state of
+    /// every window that received input while events were being polled.
+    /// @warning The GLFW mutex must be locked.
+    void FinishPolledWindows();
+
+    /// @brief Stops finishing the polls of a window that is being destroyed.
+    /// @warning The GLFW mutex must be locked.
+    void ForgetWindow(window* Window);
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     ///                        Public Member Functions                       ///
@@ -96,10 +191,12 @@ class instance : internal::uncopyable_unmovable // NOLINT
             instance_joystick_event_callback_config::NONE);
 
     /// @brief Polls events for all windows.
+    /// @remark Also runs the window operations requested by other threads.
+    /// Must be called from the thread that created the instance.
     void PollEvents();
 
-    /// @brief Waits until a window event is received, then polls events for all
-    /// windows.
+    /// @brief Waits until a window event is received or another thread
+    /// requests a window operation, then polls events for all windows.
     void WaitThenPollEvents();
 
     /// @brief Waits until either the timeout (measured in milliseconds) expires
@@ -113,12 +210,48 @@ class instance : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] window_ptr CreateWindow(
         const window_info& Window_Info = window_info_config::DEFAULT);
 
+    /// @brief Creates many windows at once. GLFW windows are created on the
+    /// calling thread, then the device objects of each window are created in
+    /// parallel by at most as many threads as the GVW thread pool has. Windows
+    /// without a device share the device of the first window created with the
+    /// same device selection info, and with it their render passes, shaders,
+    /// and pipelines. Static vertices are uploaded with one submission per
+    /// device.
+    /// @warning Must be called from the main thread.
+    [[nodiscard]] std::vector<window_ptr> CreateWindows(
+        std::span<const window_info> Window_Infos);
+
+    /// @brief Draws a frame for each window. Windows that share a graphics
+    /// queue are submitted with one call to vkQueueSubmit, and windows that
+    /// share a presentation queue are presented with one call to
+    /// vkQueuePresentKHR.
+    /// @remark Each window may appear at most once.
+    void DrawFrames(std::span<const window_frame_info> Frames);
+
     /// @brief Selects physical devices for graphics processing.
     [[nodiscard]] std::vector<gvw::device_ptr> SelectPhysicalDevices(
         const device_selection_info& Device_Info =
             device_selection_info_config::DEFAULT,
         const vk::SurfaceKHR* Window_Surface = nullptr);
 
+    /// @brief Returns a device created by this instance that is compatible
+    /// with the device selection info and the surface, or selects a new one
+    /// if none are compatible.
+    /// @remark Windows sharing a device also share its render passes,
+    /// shaders, pipelines, and memory.
+    [[nodiscard]] device_ptr GetSharedDevice(
+        const device_selection_info& Device_Info,
+        vk::SurfaceKHR Window_Surface);
+
+    /// @brief Returns every logical device created by this instance that is
+    /// still alive.
+    [[nodiscard]] std::vector<device_ptr> GetDevices();
+
+    /// @brief Discards the cached physical devices and their capabilities.
+    /// Call this after physical devices are added or removed, or after a
+    /// device is lost.
+    void InvalidateDeviceCache();
+
     /// @brief Creates a monitor object.
     [[nodiscard]] monitor_ptr GetMonitor(
         const monitor_info& Monitor_Info = monitor_info_config::DEFAULT);
@@ -1,5 +1,9 @@
+// Standard includes
+#include <algorithm>
+
 // Local includes
 #include "gvw.ipp"
+#include "archive.hpp"
 
 namespace gvw::internal {
 
@@ -18,6 +22,66 @@ bool NotInitializedTemplate(bool Condition,
     return true;
 }
 
+uint64_t Fnv1a64(const void* Data, size_t Size, uint64_t Seed)
+{
+    const uint64_t PRIME = 0x100000001b3; // NOLINT
+    const auto* bytes = static_cast<const uint8_t*>(Data);
+    uint64_t hash = Seed;
+    for (size_t i = 0; i < Size; ++i) {
+        hash ^= bytes[i]; // NOLINT
+        hash *= PRIME;
+    }
+    return hash;
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::scoped_lock lock(this->tasksMutex);
+        this->stopping = true;
+    }
+    this->tasksCondition.notify_all();
+    for (auto& worker : this->workers) {
+        worker.join();
+    }
+}
+
+size_t thread_pool::GetThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+void thread_pool::Start()
+{
+    if (!this->workers.empty()) {
+        return;
+    }
+    size_t threadCount = GetThreadCount();
+    this->workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        this->workers.emplace_back([this]() { this->Work(); });
+    }
+}
+
+void thread_pool::Work()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(this->tasksMutex);
+            this->tasksCondition.wait(lock, [this]() {
+                return this->stopping || !this->tasks.empty();
+            });
+            if (this->tasks.empty()) {
+                return;
+            }
+            task = std::move(this->tasks.front());
+            this->tasks.pop_front();
+        }
+        task();
+    }
+}
+
 /*****************************    GVW Instance    *****************************/
 bool NotInitialized(const std::string& Function_Name)
 {
@@ -26,18 +90,129 @@ bool NotInitialized(const std::string& Function_Name)
                                   Function_Name);
 }
 
+/********************************    Archive    *******************************/
+file_view_ptr FindInMountedArchives(const char* Name)
+{
+    std::scoped_lock lock(global::MOUNTED_ARCHIVES_MUTEX);
+    for (auto archive = global::MOUNTED_ARCHIVES.rbegin();
+         archive != global::MOUNTED_ARCHIVES.rend();
+         ++archive) {
+        file_view_ptr view = (*archive)->Find(Name);
+        if (view != nullptr) {
+            return view;
+        }
+    }
+    return nullptr;
+}
+
 /********************************    Window    ********************************/
 
+void PostToMainThread(std::function<void()> Function)
+{
+    if (std::this_thread::get_id() == global::MAIN_THREAD_ID) {
+        std::scoped_lock lock(global::GLFW_MUTEX);
+        Function();
+        return;
+    }
+
+    {
+        std::scoped_lock lock(global::MAIN_THREAD_TASKS_MUTEX);
+        global::MAIN_THREAD_TASKS.emplace_back(std::move(Function));
+    }
+
+    // Wake the main thread if it is waiting for events.
+    glfwPostEmptyEvent();
+}
+
+void RunMainThreadTasks()
+{
+    std::deque<std::function<void()>> tasks;
+    {
+        std::scoped_lock lock(global::MAIN_THREAD_TASKS_MUTEX);
+        tasks.swap(global::MAIN_THREAD_TASKS);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
 void* GetUserPointer(GLFWwindow* Window)
 {
     /// @todo Verify that GVW and GLFW are initialized.
     return glfwGetWindowUserPointer(Window);
 }
 
+template<typename Event_Type>
+void CoalesceValue(Event_Type& Coalesced_Value,
+                   const Event_Type& Value,
+                   window_event_coalescing Coalescing)
+{
+    if constexpr (requires { Value.x + Value.y; }) {
+        if (Coalescing == window_event_coalescing::eAccumulate) {
+            Coalesced_Value.x += Value.x;
+            Coalesced_Value.y += Value.y;
+            return;
+        }
+    }
+    Coalesced_Value = Value;
+}
+
+// Several event types share the same underlying type.
+template void CoalesceValue(coordinate<double>&,
+                            const coordinate<double>&,
+                            window_event_coalescing);
+template void CoalesceValue(coordinate<float>&,
+                            const coordinate<float>&,
+                            window_event_coalescing);
+template void CoalesceValue(coordinate<int>&,
+                            const coordinate<int>&,
+                            window_event_coalescing);
+template void CoalesceValue(area<int>&,
+                            const area<int>&,
+                            window_event_coalescing);
+
+void CoalesceEvent(window_event& Coalesced_Event,
+                   const window_event& Event,
+                   window_event_coalescing Coalescing)
+{
+    Coalesced_Event.time = Event.time;
+    switch (Event.type) {
+        case window_event_type::eCursorPosition:
+            CoalesceValue(Coalesced_Event.cursorPosition,
+                          Event.cursorPosition,
+                          Coalescing);
+            break;
+        case window_event_type::eScroll:
+            CoalesceValue(Coalesced_Event.scroll, Event.scroll, Coalescing);
+            break;
+        case window_event_type::eSize:
+            CoalesceValue(Coalesced_Event.size, Event.size, Coalescing);
+            break;
+        case window_event_type::eFramebufferSize:
+            CoalesceValue(Coalesced_Event.framebufferSize,
+                          Event.framebufferSize,
+                          Coalescing);
+            break;
+        case window_event_type::eContentScale:
+            CoalesceValue(
+                Coalesced_Event.contentScale, Event.contentScale, Coalescing);
+            break;
+        case window_event_type::ePosition:
+            CoalesceValue(Coalesced_Event.position, Event.position, Coalescing);
+            break;
+        default:
+            Coalesced_Event = Event;
+            break;
+    }
+}
+
 /********************************    Global    ********************************/
 namespace global {
 instance_ptr GVW_INSTANCE = nullptr;
 std::mutex GLFW_MUTEX;
+std::thread::id MAIN_THREAD_ID;
+std::deque<std::function<void()>> MAIN_THREAD_TASKS;
+std::mutex MAIN_THREAD_TASKS_MUTEX;
 std::mutex CONSOLE_MUTEX;
 instance_verbose_callback VERBOSE_CALLBACK = nullptr;
 std::mutex VERBOSE_CALLBACK_MUTEX;
@@ -50,6 +225,9 @@ std::mutex ERROR_CALLBACK_MUTEX;
 instance_glfw_error_callback GLFW_ERROR_CALLBACK = nullptr;
 std::vector<instance_joystick_event> JOYSTICK_EVENTS;
 std::mutex JOYSTICK_EVENTS_MUTEX;
+std::vector<archive_ptr> MOUNTED_ARCHIVES;
+std::mutex MOUNTED_ARCHIVES_MUTEX;
+thread_pool THREAD_POOL;
 } // namespace global
 
 } // namespace gvw::internal
\ No newline at end of file
@@ -9,6 +9,9 @@
 
 // Standard includes
 #include <concepts>
+#include <deque>
+#include <functional>
+#include <thread>
 
 // Local includes
 #include "gvw.hpp"
@@ -30,6 +33,20 @@ struct uncopyable_unmovable;
 template<typename... Args>
 class terminator;
 
+/// @brief A fixed set of worker threads that run submitted tasks in order of
+/// submission.
+class thread_pool;
+
+/// @brief A fixed capacity ring buffer written by one thread and read by one
+/// other thread. Neither pushing nor popping locks or allocates.
+template<typename Type, size_t Capacity>
+class spsc_ring;
+
+/// @brief A value written by one thread and read by any number of threads.
+/// Readers retry instead of locking if they overlap a write.
+template<typename Type>
+class seqlock;
+
 enum struct glfw_bool;
 
 /// @brief Returns a vector containing all the items present in both arrays.
@@ -62,6 +79,12 @@ bool NotInitializedTemplate(bool Condition,
                             const std::string& If_False,
                             const std::string& Function_Name);
 
+/// @brief Hashes bytes with 64-bit FNV-1a. Pass a previous result as the seed
+/// to hash discontiguous data.
+[[nodiscard]] uint64_t Fnv1a64(const void* Data,
+                               size_t Size,
+                               uint64_t Seed = 0xcbf29ce484222325); // NOLINT
+
 /*********************************    Hints    ********************************/
 /// @brief GLFW hint ID and default value.
 /// @tparam T The value type of the hint. Almost always int. Sometimes
@@ -86,9 +109,35 @@ template<int_hint_function IntHintFunc,
          size_t StringHints>
 struct glfw_hints;
 
+/*******************************    File View    ******************************/
+using file_view_public_constructor = public_constructor<file_view>;
+
+/********************************    Archive    *******************************/
+using archive_public_constructor = public_constructor<archive>;
+
+/// @brief The first bytes of an archive.
+struct archive_header;
+
+/// @brief Describes one file within an archive. The index is sorted by name.
+struct archive_index_entry;
+
+/// @brief Returns a view of a file within the most recently mounted archive
+/// that contains it, or nullptr if no mounted archive contains it.
+[[nodiscard]] file_view_ptr FindInMountedArchives(const char* Name);
+
+/// @brief Maps a file from the file system without searching the mounted
+/// archives. Returns nullptr on failure.
+[[nodiscard]] file_view_ptr MapFileFromFileSystem(const char* Path);
+
 /*********************************    Image    ********************************/
 using image_public_constructor = public_constructor<image>;
 
+/******************************    Image Cache    *****************************/
+using image_cache_public_constructor = public_constructor<image_cache>;
+
+/*********************************    Atlas    ********************************/
+using atlas_public_constructor = public_constructor<atlas>;
+
 /*****************************    GVW Instance    *****************************/
 using instance_public_constructor = public_constructor<instance>;
 
@@ -116,6 +165,25 @@ void GlfwErrorCallbackTemplate(int Error_Code, const char* Message);
 /// @brief Pass a message to the GVW error callback if GVW is not initialized.
 bool NotInitialized(const std::string& Function_Name);
 
+/// @brief Runs a callable on the thread that created the GVW instance and
+/// returns its result. Called from any other thread, the callable is queued
+/// until that thread next polls events, and the caller blocks until it runs.
+/// Exceptions thrown by the callable are rethrown to the caller.
+/// @warning The main thread must keep polling events while other threads wait
+/// on it. The callable must not call back into GVW functions that lock the
+/// GLFW mutex.
+template<typename Callable>
+std::invoke_result_t<Callable> RunOnMainThread(Callable&& Function);
+
+/// @brief Runs a function on the thread that created the GVW instance without
+/// waiting for it. Called from any other thread, the function runs the next
+/// time that thread polls events.
+void PostToMainThread(std::function<void()> Function);
+
+/// @brief Runs the callables queued by `RunOnMainThread`.
+/// @warning Must be called from the main thread with the GLFW mutex locked.
+void RunMainThreadTasks();
+
 /********************************    Monitor    *******************************/
 using monitor_public_constructor = public_constructor<monitor>;
 
@@ -131,6 +199,20 @@ using window_input_mode_sticky_mouse_buttons = internal::glfw_bool;
 /// @warning GLFW must be initialized.
 [[nodiscard]] void* GetUserPointer(GLFWwindow* Window);
 
+/// @brief Merges an event value into a coalesced value according to a
+/// coalescing policy other than `eKeepAll`.
+/// @remark Instantiated for the event types that can be coalesced.
+template<typename Event_Type>
+void CoalesceValue(Event_Type& Coalesced_Value,
+                   const Event_Type& Value,
+                   window_event_coalescing Coalescing);
+
+/// @brief Merges an event into a coalesced event of the same type according to
+/// a coalescing policy other than `eKeepAll`.
+void CoalesceEvent(window_event& Coalesced_Event,
+                   const window_event& Event,
+                   window_event_coalescing Coalescing);
+
 /********************************    Cursor    ********************************/
 using cursor_public_constructor = public_constructor<cursor>;
 
@@ -141,9 +223,22 @@ using vertex_shader_public_constructor = public_constructor<vertex_shader>;
 
 using fragment_shader_public_constructor = public_constructor<fragment_shader>;
 
+/***************************    Memory Allocator    ***************************/
+using memory_allocator_public_constructor =
+    public_constructor<memory_allocator>;
+
+using memory_allocation_public_constructor =
+    public_constructor<memory_allocation>;
+
 /********************************    Buffer    ********************************/
 using buffer_public_constructor = public_constructor<buffer>;
 
+/*****************************    Upload Batch    *****************************/
+using upload_batch_public_constructor = public_constructor<upload_batch>;
+
+/*********************************    Queue    ********************************/
+using queue_public_constructor = public_constructor<queue>;
+
 /******************************    Render Pass    *****************************/
 using render_pass_public_constructor = public_constructor<render_pass>;
 
@@ -160,6 +255,11 @@ using device_public_constructor = public_constructor<device>;
 namespace global {
 extern instance_ptr GVW_INSTANCE;
 extern std::mutex GLFW_MUTEX;
+/// @brief The thread that created the GVW instance. GLFW window functions are
+/// only called from this thread.
+extern std::thread::id MAIN_THREAD_ID;
+extern std::deque<std::function<void()>> MAIN_THREAD_TASKS;
+extern std::mutex MAIN_THREAD_TASKS_MUTEX;
 /// @todo Use internal::global::CONSOLE_MUTEX.
 extern std::mutex CONSOLE_MUTEX;
 extern instance_verbose_callback VERBOSE_CALLBACK;
@@ -173,6 +273,10 @@ extern std::mutex ERROR_CALLBACK_MUTEX;
 extern instance_glfw_error_callback GLFW_ERROR_CALLBACK;
 extern std::vector<instance_joystick_event> JOYSTICK_EVENTS;
 extern std::mutex JOYSTICK_EVENTS_MUTEX;
+extern std::vector<archive_ptr> MOUNTED_ARCHIVES;
+extern std::mutex MOUNTED_ARCHIVES_MUTEX;
+/// @brief The worker pool shared by all asynchronous GVW operations.
+extern thread_pool THREAD_POOL;
 } // namespace global
 
 } // namespace gvw::internal
\ No newline at end of file
@@ -1,7 +1,16 @@
 #pragma once
 
 // Standard includes
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
 #include <list>
+#include <deque>
+#include <functional>
+#include <future>
+#include <thread>
+#include <condition_variable>
 
 // Local includes
 #include "gvw.hpp"
@@ -53,6 +62,199 @@ class terminator
     ~terminator() { std::apply(this->deleter, this->args); }
 };
 
+class thread_pool
+{
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    bool stopping = false;
+
+    /// @brief Starts the worker threads if they have not been started yet.
+    /// @warning The tasks mutex must be locked.
+    void Start();
+
+    /// @brief Runs tasks until the pool is destroyed.
+    void Work();
+
+  public:
+    thread_pool() = default;
+    thread_pool(const thread_pool&) = delete;
+    thread_pool(thread_pool&&) noexcept = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    thread_pool& operator=(thread_pool&&) noexcept = delete;
+    ~thread_pool();
+
+    /// @brief Returns the number of worker threads.
+    [[nodiscard]] static size_t GetThreadCount();
+
+    /// @brief Queues a task and returns a future for its result. Exceptions
+    /// thrown by the task are rethrown by the future.
+    /// @remark Worker threads are started by the first submission.
+    /// @warning Tasks must not wait on other tasks submitted to the same pool.
+    template<typename Callable>
+    [[nodiscard]] std::future<std::invoke_result_t<Callable>> Submit(
+        Callable&& Task)
+    {
+        using result = std::invoke_result_t<Callable>;
+        // std::function requires a copyable target.
+        auto packagedTask = std::make_shared<std::packaged_task<result()>>(
+            std::forward<Callable>(Task));
+        std::future<result> future = packagedTask->get_future();
+        {
+            std::scoped_lock lock(this->tasksMutex);
+            this->Start();
+            this->tasks.emplace_back(
+                [packagedTask]() { (*packagedTask)(); });
+        }
+        this->tasksCondition.notify_one();
+        return future;
+    }
+};
+
+template<typename Type, size_t Capacity>
+class spsc_ring
+{
+    static_assert(std::has_single_bit(Capacity),
+                  "The capacity of a ring must be a power of two.");
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "Ring elements are copied without synchronization.");
+
+    /// @brief Separates the indices written by each thread so that they do
+    /// not share a cache line.
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /// @brief The total number of elements pushed and popped. Slots are
+    /// indexed modulo the capacity.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> pushCount = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> popCount = 0;
+
+    /// @brief The last counts read from the other thread. Only reloaded when
+    /// the ring appears to be full or empty.
+    alignas(CACHE_LINE_SIZE) size_t producerPopCount = 0;
+    alignas(CACHE_LINE_SIZE) size_t consumerPushCount = 0;
+
+    alignas(CACHE_LINE_SIZE) std::array<Type, Capacity> slots;
+
+  public:
+    spsc_ring() = default;
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring(spsc_ring&&) noexcept = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+    spsc_ring& operator=(spsc_ring&&) noexcept = delete;
+    ~spsc_ring() = default;
+
+    /// @brief Appends an element. Returns false if the ring already holds
+    /// `Limit` elements. A limit below the capacity reserves the remaining
+    /// slots for elements pushed with a higher limit.
+    /// @warning Must only be called from the producer thread.
+    bool TryPush(const Type& Element, size_t Limit = Capacity) noexcept
+    {
+        size_t index = this->pushCount.load(std::memory_order_relaxed);
+        if (index - this->producerPopCount >= Limit) {
+            this->producerPopCount =
+                this->popCount.load(std::memory_order_acquire);
+            if (index - this->producerPopCount >= Limit) {
+                return false;
+            }
+        }
+        this->slots[index & (Capacity - 1)] = Element;
+        this->pushCount.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Removes the oldest element. Returns false if the ring is empty.
+    /// @warning Must only be called from the consumer thread.
+    bool TryPop(Type& Element) noexcept
+    {
+        size_t index = this->popCount.load(std::memory_order_relaxed);
+        if (index == this->consumerPushCount) {
+            this->consumerPushCount =
+                this->pushCount.load(std::memory_order_acquire);
+            if (index == this->consumerPushCount) {
+                return false;
+            }
+        }
+        Element = this->slots[index & (Capacity - 1)];
+        this->popCount.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Returns the number of elements in the ring. The result may be
+    /// stale by the time it is returned.
+    [[nodiscard]] size_t Size() const noexcept
+    {
+        return this->pushCount.load(std::memory_order_acquire) -
+               this->popCount.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] static constexpr size_t GetCapacity() noexcept
+    {
+        return Capacity;
+    }
+};
+
+template<typename Type>
+class seqlock
+{
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "Values are copied word by word.");
+
+    static constexpr size_t WORD_COUNT =
+        (sizeof(Type) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    /// @brief Odd while a write is in progress.
+    std::atomic<uint64_t> sequence = 0;
+
+    /// @brief The value stored as atomic words so that a read overlapping a
+    /// write is not a data race.
+    std::array<std::atomic<uint64_t>, WORD_COUNT> words{};
+
+  public:
+    seqlock() = default;
+    seqlock(const seqlock&) = delete;
+    seqlock(seqlock&&) noexcept = delete;
+    seqlock& operator=(const seqlock&) = delete;
+    seqlock& operator=(seqlock&&) noexcept = delete;
+    ~seqlock() = default;
+
+    /// @brief Replaces the value.
+    /// @warning Must only be called from one thread at a time.
+    void Store(const Type& Value) noexcept
+    {
+        std::array<uint64_t, WORD_COUNT> buffer{};
+        std::memcpy(buffer.data(), &Value, sizeof(Type));
+
+        uint64_t start = this->sequence.load(std::memory_order_relaxed);
+        this->sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            this->words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        this->sequence.store(start + 2, std::memory_order_release);
+    }
+
+    /// @brief Returns the last stored value.
+    [[nodiscard]] Type Load() const noexcept
+    {
+        std::array<uint64_t, WORD_COUNT> buffer{};
+        uint64_t start = 0;
+        uint64_t end = 0;
+        do {
+            start = this->sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < WORD_COUNT; ++i) {
+                buffer[i] = this->words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            end = this->sequence.load(std::memory_order_relaxed);
+        } while (start != end || (start & 1) != 0);
+
+        Type value{};
+        std::memcpy(&value, buffer.data(), sizeof(Type));
+        return value;
+    }
+};
+
 enum struct glfw_bool
 {
     // NOLINTBEGIN
@@ -137,6 +339,23 @@ std::vector<Type1> GetUncommonElementsInArr1(
     return uncommonElementsInArr1;
 }
 
+template<typename Callable>
+std::invoke_result_t<Callable> RunOnMainThread(Callable&& Function)
+{
+    if (std::this_thread::get_id() == global::MAIN_THREAD_ID) {
+        std::scoped_lock lock(global::GLFW_MUTEX);
+        return std::forward<Callable>(Function)();
+    }
+
+    using result = std::invoke_result_t<Callable>;
+    // std::function requires a copyable target.
+    auto packagedTask = std::make_shared<std::packaged_task<result()>>(
+        std::forward<Callable>(Function));
+    std::future<result> future = packagedTask->get_future();
+    PostToMainThread([packagedTask]() { (*packagedTask)(); });
+    return future.get();
+}
+
 template<typename T>
 struct glfw_hint
 {
@@ -290,6 +509,32 @@ void GlfwErrorCallbackTemplate(int Error_Code, const char* Message)
     PrintFunction(errorMessage.c_str());
 }
 
+/// @remark Archives are written in the byte order of the host.
+struct archive_header
+{
+    static constexpr std::array<char, 4> MAGIC = { 'G', 'V', 'W', 'A' };
+    static constexpr uint32_t VERSION = 1;
+
+    std::array<char, 4> magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+};
+
+struct archive_index_entry
+{
+    /// @brief The offset and size of the name within the archive.
+    uint64_t nameOffset;
+    uint64_t nameSize;
+
+    /// @brief The offset and size of the file within the archive.
+    uint64_t dataOffset;
+    uint64_t dataSize;
+
+    /// @brief The FNV-1a hash of the file.
+    uint64_t dataHash;
+};
+
 enum struct window_input_mode
 {
     // NOLINTBEGIN
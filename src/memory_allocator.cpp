@@ -0,0 +1,334 @@
+// Standard includes
+#include <algorithm>
+
+// Local includes
+#include "gvw.ipp"
+#include "memory_allocator.hpp"
+
+namespace gvw {
+
+memory_allocator::memory_allocator(
+    vk::Device Device,
+    const vk::PhysicalDeviceMemoryProperties& Memory_Properties)
+    : device(Device)
+    , memoryProperties(Memory_Properties)
+    , blocks(this->memoryProperties.memoryTypeCount)
+    , typeAllocatedBytes(this->memoryProperties.memoryTypeCount)
+    , typeUsedBytes(this->memoryProperties.memoryTypeCount)
+{
+}
+
+vk::DeviceSize memory_allocator::GetBlockSize(uint32_t Memory_Type_Index) const
+{
+    uint32_t heapIndex =
+        this->memoryProperties.memoryTypes.at(Memory_Type_Index).heapIndex;
+    vk::DeviceSize heapSize =
+        this->memoryProperties.memoryHeaps.at(heapIndex).size;
+    if (heapSize <= SMALL_HEAP_SIZE) {
+        return heapSize / SMALL_HEAP_BLOCK_DIVISOR;
+    }
+    return PREFERRED_BLOCK_SIZE;
+}
+
+std::pair<vk::UniqueDeviceMemory, void*> memory_allocator::AllocateDeviceMemory(
+    vk::DeviceSize Size,
+    uint32_t Memory_Type_Index)
+{
+    vk::MemoryAllocateInfo memoryAllocateInfo = { .allocationSize = Size,
+                                                  .memoryTypeIndex =
+                                                      Memory_Type_Index };
+    vk::UniqueDeviceMemory memory =
+        this->device.allocateMemoryUnique(memoryAllocateInfo);
+
+    void* mappedData = nullptr;
+    if (this->memoryProperties.memoryTypes.at(Memory_Type_Index).propertyFlags &
+        vk::MemoryPropertyFlagBits::eHostVisible) {
+        // Memory is unmapped implicitly when it is freed.
+        mappedData =
+            this->device.mapMemory(memory.get(), 0, VK_WHOLE_SIZE, {});
+    }
+    return { std::move(memory), mappedData };
+}
+
+std::optional<vk::DeviceSize> memory_allocator::Reserve(
+    block& Block,
+    vk::DeviceSize Size,
+    vk::DeviceSize Alignment)
+{
+    for (auto range = Block.freeRanges.begin(); range != Block.freeRanges.end();
+         ++range) {
+        auto [rangeOffset, rangeSize] = *range;
+        // Vulkan guarantees that alignments are powers of two.
+        vk::DeviceSize alignedOffset = (rangeOffset + Alignment - 1) &
+                                       ~(Alignment - 1);
+        vk::DeviceSize padding = alignedOffset - rangeOffset;
+        if (padding > rangeSize || Size > rangeSize - padding) {
+            continue;
+        }
+
+        Block.freeRanges.erase(range);
+        if (padding > 0) {
+            Block.freeRanges.emplace(rangeOffset, padding);
+        }
+        vk::DeviceSize remainder = rangeSize - padding - Size;
+        if (remainder > 0) {
+            Block.freeRanges.emplace(alignedOffset + Size, remainder);
+        }
+        return alignedOffset;
+    }
+    return std::nullopt;
+}
+
+void memory_allocator::Release(block& Block,
+                               vk::DeviceSize Offset,
+                               vk::DeviceSize Size)
+{
+    vk::DeviceSize rangeOffset = Offset;
+    vk::DeviceSize rangeSize = Size;
+
+    auto next = Block.freeRanges.lower_bound(Offset);
+    if (next != Block.freeRanges.end() && next->first == Offset + Size) {
+        rangeSize += next->second;
+        next = Block.freeRanges.erase(next);
+    }
+    if (next != Block.freeRanges.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == Offset) {
+            rangeOffset = previous->first;
+            rangeSize += previous->second;
+            Block.freeRanges.erase(previous);
+        }
+    }
+    Block.freeRanges.emplace(rangeOffset, rangeSize);
+}
+
+void memory_allocator::Free(memory_allocation& Allocation)
+{
+    std::scoped_lock lock(this->mutex);
+    --this->allocationCount;
+    this->usedBytes -= Allocation.size;
+    this->typeUsedBytes.at(Allocation.memoryTypeIndex) -= Allocation.size;
+    this->categoryUsedBytes.at(Allocation.category) -= Allocation.size;
+    auto ownerUsedBytes = this->ownerUsedBytes.find(Allocation.owner);
+    ownerUsedBytes->second -= Allocation.size;
+    if (ownerUsedBytes->second == 0) {
+        this->ownerUsedBytes.erase(ownerUsedBytes);
+    }
+
+    if (Allocation.parentBlock == nullptr) {
+        // The allocation frees its own dedicated memory.
+        --this->dedicatedAllocationCount;
+        this->dedicatedAllocationBytes -= Allocation.size;
+        this->typeAllocatedBytes.at(Allocation.memoryTypeIndex) -=
+            Allocation.size;
+        return;
+    }
+
+    block& parentBlock = *Allocation.parentBlock;
+    Release(parentBlock, Allocation.offset, Allocation.size);
+    --parentBlock.allocationCount;
+    if (parentBlock.allocationCount > 0) {
+        return;
+    }
+
+    // Keep one empty block per memory type so that recreating a resource does
+    // not allocate device memory again.
+    std::vector<std::unique_ptr<block>>& typeBlocks =
+        this->blocks.at(parentBlock.memoryTypeIndex);
+    bool otherBlockIsEmpty =
+        std::any_of(typeBlocks.begin(),
+                    typeBlocks.end(),
+                    [&](const std::unique_ptr<block>& Block) {
+                        return Block.get() != &parentBlock &&
+                               Block->allocationCount == 0;
+                    });
+    if (otherBlockIsEmpty) {
+        this->typeAllocatedBytes.at(parentBlock.memoryTypeIndex) -=
+            parentBlock.size;
+        std::erase_if(typeBlocks, [&](const std::unique_ptr<block>& Block) {
+            return Block.get() == &parentBlock;
+        });
+    }
+}
+
+memory_allocation_ptr memory_allocator::Allocate(
+    const vk::MemoryRequirements& Memory_Requirements,
+    uint32_t Memory_Type_Index,
+    memory_category Category,
+    const void* Owner)
+{
+    memory_allocation_ptr allocation =
+        std::make_shared<internal::memory_allocation_public_constructor>();
+    allocation->size = Memory_Requirements.size;
+    allocation->memoryTypeIndex = Memory_Type_Index;
+    allocation->category = Category;
+    allocation->owner = Owner;
+
+    // Accounts for an allocation once it can no longer fail.
+    auto account = [&]() {
+        ++this->allocationCount;
+        this->usedBytes += allocation->size;
+        this->typeUsedBytes.at(Memory_Type_Index) += allocation->size;
+        this->categoryUsedBytes[Category] += allocation->size;
+        this->ownerUsedBytes[Owner] += allocation->size;
+        allocation->allocator = this->shared_from_this();
+    };
+
+    vk::DeviceSize blockSize = this->GetBlockSize(Memory_Type_Index);
+    if (Memory_Requirements.size <= blockSize / 2) {
+        std::scoped_lock lock(this->mutex);
+        std::vector<std::unique_ptr<block>>& typeBlocks =
+            this->blocks.at(Memory_Type_Index);
+
+        for (auto& typeBlock : typeBlocks) {
+            std::optional<vk::DeviceSize> offset =
+                Reserve(*typeBlock,
+                        Memory_Requirements.size,
+                        Memory_Requirements.alignment);
+            if (offset.has_value()) {
+                allocation->parentBlock = typeBlock.get();
+                allocation->offset = offset.value();
+                break;
+            }
+        }
+
+        if (allocation->parentBlock == nullptr) {
+            try {
+                auto [memory, mappedData] =
+                    this->AllocateDeviceMemory(blockSize, Memory_Type_Index);
+                auto newBlock = std::make_unique<block>();
+                newBlock->memory = std::move(memory);
+                newBlock->size = blockSize;
+                newBlock->memoryTypeIndex = Memory_Type_Index;
+                newBlock->mappedData = mappedData;
+                newBlock->freeRanges.emplace(0, blockSize);
+                allocation->offset = Reserve(*newBlock,
+                                             Memory_Requirements.size,
+                                             Memory_Requirements.alignment)
+                                         .value();
+                allocation->parentBlock = newBlock.get();
+                typeBlocks.emplace_back(std::move(newBlock));
+                this->typeAllocatedBytes.at(Memory_Type_Index) += blockSize;
+            } catch (const vk::OutOfDeviceMemoryError&) {
+                // A dedicated allocation of the exact size may still fit.
+            }
+        }
+
+        if (allocation->parentBlock != nullptr) {
+            block& parentBlock = *allocation->parentBlock;
+            allocation->memory = parentBlock.memory.get();
+            if (parentBlock.mappedData != nullptr) {
+                allocation->mappedData =
+                    static_cast<char*>(parentBlock.mappedData) + // NOLINT
+                    allocation->offset;
+            }
+            ++parentBlock.allocationCount;
+            account();
+            return allocation;
+        }
+    }
+
+    // Large allocations receive their own device memory so that they do not
+    // leave unusable space at the end of blocks.
+    auto [memory, mappedData] =
+        this->AllocateDeviceMemory(Memory_Requirements.size, Memory_Type_Index);
+    allocation->memory = memory.get();
+    allocation->dedicatedMemory = std::move(memory);
+    allocation->mappedData = mappedData;
+
+    std::scoped_lock lock(this->mutex);
+    ++this->dedicatedAllocationCount;
+    this->dedicatedAllocationBytes += allocation->size;
+    this->typeAllocatedBytes.at(Memory_Type_Index) += allocation->size;
+    account();
+    return allocation;
+}
+
+memory_allocator_statistics memory_allocator::GetStatistics()
+{
+    std::scoped_lock lock(this->mutex);
+    memory_allocator_statistics statistics = {
+        .dedicatedAllocationCount = this->dedicatedAllocationCount,
+        .allocationCount = this->allocationCount,
+        .allocatedBytes = this->dedicatedAllocationBytes,
+        .usedBytes = this->usedBytes
+    };
+    for (const auto& typeBlocks : this->blocks) {
+        for (const auto& typeBlock : typeBlocks) {
+            ++statistics.blockCount;
+            statistics.allocatedBytes += typeBlock->size;
+            for (const auto& [offset, size] : typeBlock->freeRanges) {
+                statistics.freeBytes += size;
+                statistics.largestFreeRange =
+                    std::max(statistics.largestFreeRange, size);
+            }
+        }
+    }
+    if (statistics.freeBytes > 0) {
+        statistics.fragmentation =
+            1.0F - (static_cast<float>(statistics.largestFreeRange) /
+                    static_cast<float>(statistics.freeBytes));
+    }
+    return statistics;
+}
+
+memory_stats memory_allocator::GetMemoryStats()
+{
+    memory_stats stats;
+    stats.heaps.resize(this->memoryProperties.memoryHeapCount);
+    for (uint32_t i = 0; i < this->memoryProperties.memoryHeapCount; ++i) {
+        stats.heaps.at(i).size = this->memoryProperties.memoryHeaps.at(i).size;
+    }
+
+    std::scoped_lock lock(this->mutex);
+    stats.types.reserve(this->memoryProperties.memoryTypeCount);
+    for (uint32_t i = 0; i < this->memoryProperties.memoryTypeCount; ++i) {
+        memory_type_stats typeStats = {
+            .heapIndex = this->memoryProperties.memoryTypes.at(i).heapIndex,
+            .allocatedBytes = this->typeAllocatedBytes.at(i),
+            .usedBytes = this->typeUsedBytes.at(i)
+        };
+        stats.heaps.at(typeStats.heapIndex).allocatedBytes +=
+            typeStats.allocatedBytes;
+        stats.heaps.at(typeStats.heapIndex).usedBytes += typeStats.usedBytes;
+        stats.types.push_back(typeStats);
+    }
+    stats.categories = this->categoryUsedBytes;
+    stats.owners = this->ownerUsedBytes;
+    return stats;
+}
+
+memory_allocation::~memory_allocation()
+{
+    // Allocations that failed never took memory from the allocator.
+    if (this->allocator != nullptr) {
+        this->allocator->Free(*this);
+    }
+}
+
+vk::DeviceMemory memory_allocation::GetMemory() const
+{
+    return this->memory;
+}
+
+vk::DeviceSize memory_allocation::GetOffset() const
+{
+    return this->offset;
+}
+
+vk::DeviceSize memory_allocation::GetSize() const
+{
+    return this->size;
+}
+
+void* memory_allocation::GetMappedData() const
+{
+    return this->mappedData;
+}
+
+bool memory_allocation::IsDedicated() const
+{
+    return this->parentBlock == nullptr;
+}
+
+} // namespace gvw
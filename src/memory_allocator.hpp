@@ -0,0 +1,217 @@
+#pragma once
+
+/**
+ * @file memory_allocator.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Device memory sub-allocator.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief Suballocates device memory from large blocks, one list of blocks per
+/// memory type.
+/// @remark Each block keeps its free ranges ordered by offset. Allocations are
+/// placed in the first free range that fits once aligned, and freed ranges are
+/// merged with their neighbors. Allocations too large to share a block receive
+/// dedicated device memory. Host visible memory is mapped once for the
+/// lifetime of its block.
+class memory_allocator
+    : internal::uncopyable_unmovable // NOLINT
+    , public std::enable_shared_from_this<memory_allocator>
+{
+    friend internal::memory_allocator_public_constructor;
+    friend memory_allocation;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    memory_allocator(
+        vk::Device Device,
+        const vk::PhysicalDeviceMemoryProperties& Memory_Properties);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~memory_allocator() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                            Private Types                             ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    struct block
+    {
+        vk::UniqueDeviceMemory memory;
+        vk::DeviceSize size = 0;
+        uint32_t memoryTypeIndex = 0;
+
+        /// @brief The start of the mapping, or nullptr if the memory is not
+        /// host visible.
+        void* mappedData = nullptr;
+
+        /// @brief Free ranges keyed by offset and mapped to their size.
+        std::map<vk::DeviceSize, vk::DeviceSize> freeRanges;
+
+        size_t allocationCount = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    static constexpr vk::DeviceSize PREFERRED_BLOCK_SIZE =
+        64ULL * 1024 * 1024; // NOLINT
+    static constexpr vk::DeviceSize SMALL_HEAP_SIZE =
+        1024ULL * 1024 * 1024;                                    // NOLINT
+    static constexpr vk::DeviceSize SMALL_HEAP_BLOCK_DIVISOR = 8; // NOLINT
+
+    vk::Device device;
+    vk::PhysicalDeviceMemoryProperties memoryProperties;
+
+    /// @brief Blocks indexed by memory type.
+    std::vector<std::vector<std::unique_ptr<block>>> blocks;
+
+    size_t dedicatedAllocationCount = 0;
+    vk::DeviceSize dedicatedAllocationBytes = 0;
+    size_t allocationCount = 0;
+    vk::DeviceSize usedBytes = 0;
+
+    /// @brief Device memory allocated and bytes used, indexed by memory type.
+    std::vector<vk::DeviceSize> typeAllocatedBytes;
+    std::vector<vk::DeviceSize> typeUsedBytes;
+
+    std::map<memory_category, vk::DeviceSize> categoryUsedBytes;
+    std::map<const void*, vk::DeviceSize> ownerUsedBytes;
+
+    std::mutex mutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the size of new blocks for a memory type. Small heaps
+    /// use smaller blocks so that a single block cannot exhaust them.
+    [[nodiscard]] vk::DeviceSize GetBlockSize(uint32_t Memory_Type_Index) const;
+
+    /// @brief Allocates device memory and maps it if it is host visible.
+    [[nodiscard]] std::pair<vk::UniqueDeviceMemory, void*> AllocateDeviceMemory(
+        vk::DeviceSize Size,
+        uint32_t Memory_Type_Index);
+
+    /// @brief Reserves an aligned range within a block. Returns the offset of
+    /// the range, or nothing if no free range is large enough.
+    [[nodiscard]] static std::optional<vk::DeviceSize> Reserve(
+        block& Block,
+        vk::DeviceSize Size,
+        vk::DeviceSize Alignment);
+
+    /// @brief Returns a range to the free ranges of a block, merging it with
+    /// adjacent free ranges.
+    static void Release(block& Block,
+                        vk::DeviceSize Offset,
+                        vk::DeviceSize Size);
+
+    /// @brief Returns the memory of an allocation to the allocator. Called by
+    /// the destructor of the allocation.
+    void Free(memory_allocation& Allocation);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Allocates memory satisfying a set of requirements from a memory
+    /// type. The allocation is accounted to a category and an owner.
+    [[nodiscard]] memory_allocation_ptr Allocate(
+        const vk::MemoryRequirements& Memory_Requirements,
+        uint32_t Memory_Type_Index,
+        memory_category Category = memory_category::eOther,
+        const void* Owner = nullptr);
+
+    [[nodiscard]] memory_allocator_statistics GetStatistics();
+
+    /// @brief Returns the memory allocated and used per heap, memory type,
+    /// category, and owner. Budgets are left for the device to fill in.
+    [[nodiscard]] memory_stats GetMemoryStats();
+};
+
+/// @brief A range of device memory owned by a memory allocator. The range is
+/// returned to the allocator when the allocation is destroyed.
+class memory_allocation : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::memory_allocation_public_constructor;
+    friend memory_allocator;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    memory_allocation() = default;
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~memory_allocation();
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    memory_allocator_ptr allocator;
+
+    /// @brief The block containing this allocation, or nullptr if the
+    /// allocation is dedicated.
+    memory_allocator::block* parentBlock = nullptr;
+
+    /// @brief The memory of a dedicated allocation.
+    vk::UniqueDeviceMemory dedicatedMemory;
+
+    vk::DeviceMemory memory;
+    vk::DeviceSize offset = 0;
+    vk::DeviceSize size = 0;
+    uint32_t memoryTypeIndex = 0;
+    void* mappedData = nullptr;
+
+    memory_category category = memory_category::eOther;
+    const void* owner = nullptr;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the device memory containing this allocation.
+    [[nodiscard]] vk::DeviceMemory GetMemory() const;
+
+    /// @brief Returns the offset of this allocation within its device memory.
+    [[nodiscard]] vk::DeviceSize GetOffset() const;
+
+    [[nodiscard]] vk::DeviceSize GetSize() const;
+
+    /// @brief Returns a pointer to the start of this allocation, or nullptr if
+    /// its memory is not host visible.
+    [[nodiscard]] void* GetMappedData() const;
+
+    /// @brief Returns whether this allocation owns its device memory.
+    [[nodiscard]] bool IsDedicated() const;
+};
+
+} // namespace gvw
@@ -0,0 +1,167 @@
+// Standard includes
+#include <algorithm>
+#include <chrono>
+
+// Local includes
+#include "gvw.ipp"
+#include "queue.hpp"
+
+namespace gvw {
+
+queue::queue(vk::Queue Handle, uint32_t Family_Index, uint32_t Queue_Index)
+    : handle(Handle)
+    , familyIndex(Family_Index)
+    , queueIndex(Queue_Index)
+{
+}
+
+std::unique_lock<std::mutex> queue::Lock()
+{
+    auto waitStart = std::chrono::steady_clock::now();
+    std::unique_lock lock(this->mutex);
+    std::chrono::nanoseconds waitTime =
+        std::chrono::steady_clock::now() - waitStart;
+    this->statistics.lockWaitTime += waitTime;
+    this->statistics.maxLockWaitTime =
+        std::max(this->statistics.maxLockWaitTime, waitTime);
+    return lock;
+}
+
+void queue::SubmitLocked(std::span<const vk::SubmitInfo> Submit_Infos,
+                         vk::Fence Fence)
+{
+    if (this->pendingSubmissions.empty() && Submit_Infos.empty() &&
+        !Fence) {
+        return;
+    }
+
+    std::vector<vk::SubmitInfo> submitInfos;
+    submitInfos.reserve(this->pendingSubmissions.size() + Submit_Infos.size());
+    for (const auto& pendingSubmission : this->pendingSubmissions) {
+        submitInfos.push_back(
+            { .waitSemaphoreCount =
+                  uint32_t(pendingSubmission.waitSemaphores.size()),
+              .pWaitSemaphores = pendingSubmission.waitSemaphores.data(),
+              .pWaitDstStageMask = pendingSubmission.waitStages.data(),
+              .commandBufferCount =
+                  uint32_t(pendingSubmission.commandBuffers.size()),
+              .pCommandBuffers = pendingSubmission.commandBuffers.data(),
+              .signalSemaphoreCount =
+                  uint32_t(pendingSubmission.signalSemaphores.size()),
+              .pSignalSemaphores = pendingSubmission.signalSemaphores.data() });
+    }
+    submitInfos.insert(
+        submitInfos.end(), Submit_Infos.begin(), Submit_Infos.end());
+
+    auto submitStart = std::chrono::steady_clock::now();
+    this->handle.submit(submitInfos, Fence);
+    this->statistics.submitTime +=
+        std::chrono::steady_clock::now() - submitStart;
+    ++this->statistics.submitCount;
+    this->statistics.submitInfoCount += submitInfos.size();
+
+    this->pendingSubmissions.clear();
+}
+
+vk::Queue queue::GetHandle() const
+{
+    return this->handle;
+}
+
+uint32_t queue::GetFamilyIndex() const
+{
+    return this->familyIndex;
+}
+
+uint32_t queue::GetQueueIndex() const
+{
+    return this->queueIndex;
+}
+
+void queue::Submit(std::span<const vk::SubmitInfo> Submit_Infos,
+                   vk::Fence Fence)
+{
+    auto lock = this->Lock();
+    this->SubmitLocked(Submit_Infos, Fence);
+}
+
+void queue::Submit(const vk::SubmitInfo& Submit_Info, vk::Fence Fence)
+{
+    this->Submit(std::span<const vk::SubmitInfo>(&Submit_Info, 1), Fence);
+}
+
+void queue::Enqueue(const vk::SubmitInfo& Submit_Info)
+{
+    if (Submit_Info.pNext != nullptr) {
+        ErrorCallback("Cannot enqueue a submission with a pNext chain.");
+        return;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    pending_submission pendingSubmission = {
+        .waitSemaphores = { Submit_Info.pWaitSemaphores,
+                            Submit_Info.pWaitSemaphores +
+                                Submit_Info.waitSemaphoreCount },
+        .waitStages = { Submit_Info.pWaitDstStageMask,
+                        Submit_Info.pWaitDstStageMask +
+                            Submit_Info.waitSemaphoreCount },
+        .commandBuffers = { Submit_Info.pCommandBuffers,
+                            Submit_Info.pCommandBuffers +
+                                Submit_Info.commandBufferCount },
+        .signalSemaphores = { Submit_Info.pSignalSemaphores,
+                              Submit_Info.pSignalSemaphores +
+                                  Submit_Info.signalSemaphoreCount }
+    };
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto lock = this->Lock();
+    this->pendingSubmissions.emplace_back(std::move(pendingSubmission));
+}
+
+void queue::Flush(vk::Fence Fence)
+{
+    auto lock = this->Lock();
+    this->SubmitLocked({}, Fence);
+}
+
+vk::Result queue::Present(const vk::PresentInfoKHR& Present_Info)
+{
+    auto lock = this->Lock();
+    this->SubmitLocked({}, nullptr);
+
+    auto presentStart = std::chrono::steady_clock::now();
+    // The pointer overload reports out of date swapchains through its return
+    // value instead of throwing.
+    vk::Result result = this->handle.presentKHR(&Present_Info);
+    this->statistics.presentTime +=
+        std::chrono::steady_clock::now() - presentStart;
+    ++this->statistics.presentCount;
+    return result;
+}
+
+void queue::WaitIdle()
+{
+    auto lock = this->Lock();
+    this->SubmitLocked({}, nullptr);
+    this->handle.waitIdle();
+}
+
+size_t queue::GetPendingSubmissionCount()
+{
+    std::scoped_lock lock(this->mutex);
+    return this->pendingSubmissions.size();
+}
+
+queue_statistics queue::GetStatistics()
+{
+    std::scoped_lock lock(this->mutex);
+    return this->statistics;
+}
+
+void queue::ResetStatistics()
+{
+    std::scoped_lock lock(this->mutex);
+    this->statistics = {};
+}
+
+} // namespace gvw
@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file queue.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Externally synchronized device queues.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <mutex>
+#include <span>
+#include <vector>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief A device queue that may be used from multiple threads.
+/// @remark Vulkan requires access to a queue to be externally synchronized.
+/// Every operation on the queue holds its lock.
+class queue : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::queue_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    queue(vk::Queue Handle, uint32_t Family_Index, uint32_t Queue_Index);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    ~queue() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                            Private Types                             ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief A copy of the arrays referenced by an enqueued submit info.
+    struct pending_submission
+    {
+        std::vector<vk::Semaphore> waitSemaphores;
+        std::vector<vk::PipelineStageFlags> waitStages;
+        std::vector<vk::CommandBuffer> commandBuffers;
+        std::vector<vk::Semaphore> signalSemaphores;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    vk::Queue handle;
+    uint32_t familyIndex;
+    uint32_t queueIndex;
+
+    /// @brief Submissions enqueued since the queue was last submitted to.
+    std::vector<pending_submission> pendingSubmissions;
+
+    queue_statistics statistics;
+
+    std::mutex mutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Locks the queue and records the time spent waiting for the lock.
+    [[nodiscard]] std::unique_lock<std::mutex> Lock();
+
+    /// @brief Submits the pending submissions followed by the given ones with
+    /// a single call to vkQueueSubmit.
+    /// @remark The queue must be locked.
+    void SubmitLocked(std::span<const vk::SubmitInfo> Submit_Infos,
+                      vk::Fence Fence);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] vk::Queue GetHandle() const;
+
+    [[nodiscard]] uint32_t GetFamilyIndex() const;
+
+    [[nodiscard]] uint32_t GetQueueIndex() const;
+
+    /// @brief Submits work to the queue. Enqueued submissions are submitted
+    /// first in the same call. The fence is signaled once all of them
+    /// complete.
+    void Submit(std::span<const vk::SubmitInfo> Submit_Infos,
+                vk::Fence Fence = nullptr);
+
+    /// @brief Submits work to the queue.
+    void Submit(const vk::SubmitInfo& Submit_Info, vk::Fence Fence = nullptr);
+
+    /// @brief Defers a submission until the next call to `Submit`, `Flush`, or
+    /// `Present` so that submissions from many sources are batched into one
+    /// call to vkQueueSubmit.
+    /// @remark The arrays referenced by the submit info are copied. Its pNext
+    /// chain must be empty.
+    void Enqueue(const vk::SubmitInfo& Submit_Info);
+
+    /// @brief Submits all enqueued submissions.
+    void Flush(vk::Fence Fence = nullptr);
+
+    /// @brief Submits all enqueued submissions, then queues an image for
+    /// presentation.
+    [[nodiscard]] vk::Result Present(const vk::PresentInfoKHR& Present_Info);
+
+    /// @brief Submits all enqueued submissions, then waits for the queue to
+    /// become idle.
+    void WaitIdle();
+
+    /// @brief Returns the number of submissions waiting to be submitted.
+    [[nodiscard]] size_t GetPendingSubmissionCount();
+
+    /// @brief Returns the time spent submitting, presenting, and waiting for
+    /// the lock of this queue.
+    [[nodiscard]] queue_statistics GetStatistics();
+
+    void ResetStatistics();
+};
+
+} // namespace gvw
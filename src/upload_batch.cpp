@@ -0,0 +1,159 @@
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// Local includes
+#include "gvw.ipp"
+#include "upload_batch.hpp"
+#include "device.hpp"
+#include "memory_allocator.hpp"
+#include "queue.hpp"
+
+namespace gvw {
+
+upload_batch::upload_batch(device_ptr Device)
+    : logicalDevice(std::move(Device))
+{
+    const auto& queueFamilyInfos = this->logicalDevice->GetQueueFamilyInfos();
+    auto graphicsQueueFamily =
+        std::find_if(queueFamilyInfos.begin(),
+                     queueFamilyInfos.end(),
+                     [](const device_selection_queue_family_info& Info) {
+                         return bool(Info.properties.queueFlags &
+                                     vk::QueueFlagBits::eGraphics);
+                     });
+    if (graphicsQueueFamily == queueFamilyInfos.end()) {
+        ErrorCallback("Cannot create an upload batch for a device without a "
+                      "graphics queue.");
+        return;
+    }
+    uint32_t queueFamilyIndex =
+        graphicsQueueFamily->createInfo.queueFamilyIndex;
+    vk::Device deviceHandle = this->logicalDevice->GetHandle();
+    this->graphicsQueue = this->logicalDevice->GetQueue(queueFamilyIndex, 0);
+
+    vk::CommandPoolCreateInfo commandPoolCreateInfo = {
+        .flags = vk::CommandPoolCreateFlagBits::eTransient,
+        .queueFamilyIndex = queueFamilyIndex
+    };
+    this->commandPool =
+        deviceHandle.createCommandPoolUnique(commandPoolCreateInfo);
+
+    vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {
+        .commandPool = this->commandPool.get(),
+        .level = vk::CommandBufferLevel::ePrimary,
+        .commandBufferCount = 1
+    };
+    this->commandBuffer = std::move(
+        deviceHandle.allocateCommandBuffersUnique(commandBufferAllocateInfo)
+            .at(0));
+    this->commandBuffer->begin(
+        { .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+}
+
+upload_batch::~upload_batch()
+{
+    try {
+        this->Submit();
+    } catch (...) { // NOLINT
+        // Destructors must not throw. The error has already been reported.
+    }
+}
+
+void upload_batch::Upload(const void* Data,
+                          vk::DeviceSize Size,
+                          const buffer_ptr& Destination,
+                          vk::DeviceSize Destination_Offset)
+{
+    if (Size == 0) {
+        return;
+    }
+    if (Destination == nullptr || Destination_Offset > Destination->size ||
+        Size > Destination->size - Destination_Offset) {
+        ErrorCallback("Upload is out of the bounds of its destination buffer.");
+        return;
+    }
+
+    std::scoped_lock lock(this->mutex);
+    if (!this->commandBuffer) {
+        return;
+    }
+
+    vk::DeviceSize alignment = std::max<vk::DeviceSize>(
+        this->logicalDevice->GetLimits().optimalBufferCopyOffsetAlignment, 1);
+    vk::DeviceSize offset =
+        (this->stagingOffset + alignment - 1) / alignment * alignment;
+    if (this->stagingBuffers.empty() ||
+        offset + Size > this->stagingBuffers.back()->size) {
+        // Uploads larger than a staging buffer receive their own.
+        this->stagingBuffers.emplace_back(this->logicalDevice->CreateBuffer(
+            { .sizeInBytes = std::max(Size, STAGING_BUFFER_SIZE),
+              .usage = vk::BufferUsageFlagBits::eTransferSrc,
+              .memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible |
+                                  vk::MemoryPropertyFlagBits::eHostCoherent,
+              .category = memory_category::eStaging,
+              .owner = this }));
+        offset = 0;
+    }
+    const buffer_ptr& stagingBuffer = this->stagingBuffers.back();
+    if (stagingBuffer == nullptr) {
+        this->stagingBuffers.pop_back();
+        return;
+    }
+
+    auto* stagingData =
+        static_cast<char*>(stagingBuffer->allocation->GetMappedData());
+    std::memcpy(stagingData + offset, // NOLINT
+                Data,
+                static_cast<size_t>(Size));
+    this->stagingOffset = offset + Size;
+
+    this->commandBuffer->copyBuffer(
+        stagingBuffer->handle.get(),
+        Destination->handle.get(),
+        vk::BufferCopy{ .srcOffset = offset,
+                        .dstOffset = Destination_Offset,
+                        .size = Size });
+    this->destinationBuffers.emplace_back(Destination);
+    ++this->pendingUploadCount;
+}
+
+void upload_batch::Submit()
+{
+    std::scoped_lock lock(this->mutex);
+    if (this->pendingUploadCount == 0) {
+        return;
+    }
+
+    this->commandBuffer->end();
+    vk::Device deviceHandle = this->logicalDevice->GetHandle();
+    vk::UniqueFence fence = deviceHandle.createFenceUnique({});
+    vk::SubmitInfo submitInfo = { .commandBufferCount = 1,
+                                  .pCommandBuffers =
+                                      &this->commandBuffer.get() };
+    this->graphicsQueue->Submit(submitInfo, fence.get());
+    if (deviceHandle.waitForFences(
+            fence.get(), VK_TRUE, std::numeric_limits<uint64_t>::max()) !=
+        vk::Result::eSuccess) {
+        ErrorCallback("Failed to wait for an upload batch to complete.");
+    }
+
+    // Release all staging memory at once.
+    this->stagingBuffers.clear();
+    this->stagingOffset = 0;
+    this->destinationBuffers.clear();
+    this->pendingUploadCount = 0;
+
+    deviceHandle.resetCommandPool(this->commandPool.get());
+    this->commandBuffer->begin(
+        { .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+}
+
+size_t upload_batch::GetPendingUploadCount()
+{
+    std::scoped_lock lock(this->mutex);
+    return this->pendingUploadCount;
+}
+
+} // namespace gvw
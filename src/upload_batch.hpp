@@ -0,0 +1,90 @@
+#pragma once
+
+/**
+ * @file upload_batch.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Batched transfers from the host to device local buffers.
+ * @date 2026-10-18
+ */
+
+// Standard includes
+#include <mutex>
+#include <vector>
+
+// Local includes
+#include "gvw.ipp"
+
+namespace gvw {
+
+/// @brief Collects uploads to device local buffers and submits them with a
+/// single command buffer, a single submission, and a single fence wait.
+/// @remark Data is copied into large staging buffers as it is uploaded. The
+/// staging buffers are released together once the submission completes.
+class upload_batch : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::upload_batch_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @remark This constructor is made private to prevent if from being called
+    /// from outside of GVW.
+    upload_batch(device_ptr Device);
+
+  public:
+    /// @brief The destructor is public so as to allow explicit destruction
+    /// using the delete operator.
+    /// @remark Submits uploads that have not been submitted yet.
+    ~upload_batch();
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    static constexpr vk::DeviceSize STAGING_BUFFER_SIZE =
+        1024ULL * 1024; // NOLINT
+
+    device_ptr logicalDevice;
+
+    /// @brief The first graphics queue of the device. Graphics queues can also
+    /// perform transfer operations.
+    queue_ptr graphicsQueue;
+
+    vk::UniqueCommandPool commandPool;
+    vk::UniqueCommandBuffer commandBuffer;
+
+    /// @brief Staging buffers filled by this batch. Only the last one has
+    /// space remaining.
+    std::vector<buffer_ptr> stagingBuffers;
+    vk::DeviceSize stagingOffset = 0;
+
+    /// @brief Keeps the destination buffers alive until the copies complete.
+    std::vector<buffer_ptr> destinationBuffers;
+
+    size_t pendingUploadCount = 0;
+
+    std::mutex mutex;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Copies data into staging memory and records a copy from it to a
+    /// range of a buffer. Nothing is transferred until the batch is submitted.
+    /// @remark Safe to call from multiple threads.
+    void Upload(const void* Data,
+                vk::DeviceSize Size,
+                const buffer_ptr& Destination,
+                vk::DeviceSize Destination_Offset = 0);
+
+    /// @brief Submits all pending uploads, waits for them to complete, and
+    /// releases their staging memory. The batch may be reused afterwards.
+    void Submit();
+
+    [[nodiscard]] size_t GetPendingUploadCount();
+};
+
+} // namespace gvw
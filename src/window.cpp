@@ -1,23 +1,44 @@
 // Standard includes
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <utility>
 
 // Local includes
 #include "gvw.ipp"
 #include "internal.ipp"
 #include "window.hpp"
+#include "memory_allocator.hpp"
+#include "upload_batch.hpp"
+#include "queue.hpp"
 #include "impl.hpp"
 
 namespace gvw {
 
 // NOLINTNEXTLINE
-void window::DestroyGlfwWindow(GLFWwindow* Window_Handle) noexcept
-{
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwDestroyWindow(Window_Handle);
+void window::DestroyGlfwWindow(GLFWwindow* Window_Handle,
+                               window* Window,
+                               std::weak_ptr<instance> Instance) noexcept
+{
+    // Windows released by other threads are destroyed the next time the main
+    // thread polls events instead of blocking the releasing thread. Queued
+    // tasks run before events are polled, so GLFW cannot call back into the
+    // destroyed window object first.
+    internal::PostToMainThread([Window_Handle, Window, Instance]() {
+        SetEventCallbacksNoMutex(Window_Handle,
+                                 window_event_callbacks_config::NONE);
+        glfwSetWindowUserPointer(Window_Handle, nullptr);
+        if (instance_ptr gvwInstance = Instance.lock()) {
+            gvwInstance->ForgetWindow(Window);
+        }
+        glfwDestroyWindow(Window_Handle);
+    });
 }
 
 // NOLINTNEXTLINE
-window::window(const window_info& Window_Info, window* Parent_Window)
+window::window(const window_info& Window_Info,
+               window* Parent_Window,
+               bool Create_Vulkan_Objects)
     : gvwInstance(internal::global::GVW_INSTANCE)
 {
     /// @todo GVW could be destroyed and then reinitialized between the
@@ -72,9 +93,9 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     /// @todo Check which GLFW hints were actually applied (many of them are not
     /// hard constraints!).
 
-    this->glfwWindowDestroyer =
-        std::make_unique<internal::terminator<GLFWwindow*>>(DestroyGlfwWindow,
-                                                            this->windowHandle);
+    this->glfwWindowDestroyer = std::make_unique<
+        internal::terminator<GLFWwindow*, window*, std::weak_ptr<instance>>>(
+        DestroyGlfwWindow, this->windowHandle, this, this->gvwInstance);
 
     this->SetUserPointer(this);
 
@@ -93,6 +114,7 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     }
 
     // Set window event callbacks.
+    this->eventCoalescing = Window_Info.eventCoalescing;
     this->SetEventCallbacks(Window_Info.eventCallbacks);
 
     // Create window surface.
@@ -110,11 +132,27 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     this->surface = vk::UniqueSurfaceKHR(
         tempSurface, *this->gvwInstance->pImpl->vulkanInstance);
 
+    // Record the framebuffer size so that the swapchain can be created without
+    // calling GLFW, which may only be called from the main thread.
+    this->creationFramebufferSize = this->GetFramebufferSizeNoMutex();
+
+    if (Create_Vulkan_Objects) {
+        this->CreateVulkanObjects(Window_Info, Parent_Window, nullptr);
+    }
+}
+
+void window::CreateVulkanObjects(const window_info& Window_Info,
+                                 window* Parent_Window,
+                                 const upload_batch_ptr& Upload_Batch)
+{
     // Use an already existing logical device or create a new one.
     if (Window_Info.device != nullptr) {
         this->logicalDevice = Window_Info.device;
     } else if (Parent_Window != nullptr) {
         this->logicalDevice = Parent_Window->logicalDevice;
+    } else if (Window_Info.shareDevice) {
+        this->logicalDevice = gvwInstance->GetSharedDevice(
+            Window_Info.deviceSelectionInfo, this->surface.get());
     } else {
         this->logicalDevice =
             gvwInstance
@@ -122,6 +160,10 @@ window::window(const window_info& Window_Info, window* Parent_Window)
                                         &this->surface.get())
                 .at(0);
     }
+    if (this->logicalDevice == nullptr) {
+        ErrorCallback("Failed to select a logical device for the window.");
+        return;
+    }
 
     // Find indicies for the graphics and present queue families.
     /// @todo Place physical device minimum requirements verification into its
@@ -130,28 +172,27 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     std::optional<uint32_t> viablePresentationQueueFamilyIndex;
     const auto& queueInfos = this->logicalDevice->GetQueueFamilyInfos();
     for (const auto& queueInfo : queueInfos) {
-        if (viableGraphicsQueueFamilyIndex.has_value() == false) {
-            if (bool(queueInfo.properties.queueFlags &
-                     vk::QueueFlagBits::eGraphics)) {
-                viableGraphicsQueueFamilyIndex =
-                    queueInfo.createInfo.queueFamilyIndex;
-            }
+        uint32_t queueFamilyIndex = queueInfo.createInfo.queueFamilyIndex;
+        bool supportsGraphics = bool(queueInfo.properties.queueFlags &
+                                     vk::QueueFlagBits::eGraphics);
+        bool supportsPresentation =
+            this->logicalDevice->GetPhysicalDevice().getSurfaceSupportKHR(
+                queueFamilyIndex, this->surface.get()) != VK_FALSE;
+
+        // Prefer a single family for both so that swapchain images are never
+        // transferred between queue families.
+        if (supportsGraphics && supportsPresentation) {
+            viableGraphicsQueueFamilyIndex = queueFamilyIndex;
+            viablePresentationQueueFamilyIndex = queueFamilyIndex;
+            break;
         }
-        if (viablePresentationQueueFamilyIndex.has_value() == false) {
-            if (this->logicalDevice->GetPhysicalDevice().getSurfaceSupportKHR(
-                    queueInfo.createInfo.queueFamilyIndex,
-                    this->surface.get()) != VK_FALSE) {
-                viablePresentationQueueFamilyIndex =
-                    queueInfo.createInfo.queueFamilyIndex;
-            }
+        if (supportsGraphics &&
+            (viableGraphicsQueueFamilyIndex.has_value() == false)) {
+            viableGraphicsQueueFamilyIndex = queueFamilyIndex;
         }
-
-        if (viableGraphicsQueueFamilyIndex.has_value() &&
-            viablePresentationQueueFamilyIndex.has_value()) {
-            if (viableGraphicsQueueFamilyIndex.value() ==
-                viablePresentationQueueFamilyIndex.value()) {
-                break;
-            }
+        if (supportsPresentation &&
+            (viablePresentationQueueFamilyIndex.has_value() == false)) {
+            viablePresentationQueueFamilyIndex = queueFamilyIndex;
         }
     }
     if (viableGraphicsQueueFamilyIndex.has_value() == false) {
@@ -165,11 +206,16 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     this->graphicsQueueIndex = viableGraphicsQueueFamilyIndex.value();
     this->presentQueueIndex = viablePresentationQueueFamilyIndex.value();
 
-    /// @todo Allow selection of specific queue indicies.
+    // Spread windows across the queues created for each family. A combined
+    // family uses the same queue for graphics and presentation.
     this->graphicsQueue =
-        this->logicalDevice->GetHandle().getQueue(this->graphicsQueueIndex, 0);
-    this->presentQueue =
-        this->logicalDevice->GetHandle().getQueue(this->presentQueueIndex, 0);
+        this->logicalDevice->AcquireQueue(this->graphicsQueueIndex);
+    if (this->presentQueueIndex == this->graphicsQueueIndex) {
+        this->presentQueue = this->graphicsQueue;
+    } else {
+        this->presentQueue =
+            this->logicalDevice->AcquireQueue(this->presentQueueIndex);
+    }
 
     // Use an already existing render pass or create a new one.
     if (Window_Info.renderPass != nullptr) {
@@ -185,12 +231,12 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     }
 
     // Create swapchain.
-    this->CreateSwapchain();
+    this->CreateSwapchain(this->creationFramebufferSize);
 
     /// @todo Place shader utilities into separate functions or within the
     /// shader class.
     if (Window_Info.shaders.vertex != nullptr) {
-        if (this->shaders.vertex->handle.getOwner() !=
+        if (Window_Info.shaders.vertex->handle.getOwner() !=
             this->logicalDevice->GetHandle()) {
             ErrorCallback("Cannot use a vertex shader created with a different "
                           "logical device.");
@@ -222,7 +268,7 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     }
 
     if (Window_Info.shaders.fragment != nullptr) {
-        if (this->shaders.fragment->handle.getOwner() !=
+        if (Window_Info.shaders.fragment->handle.getOwner() !=
             this->logicalDevice->GetHandle()) {
             ErrorCallback("Cannot use a fragment shader created with a "
                           "different logical device.");
@@ -273,60 +319,52 @@ window::window(const window_info& Window_Info, window* Parent_Window)
             .allocateCommandBuffersUnique(stagingCommandBufferAllocateInfo)
             .at(0));
 
-    // Create staging vertex buffer for static vertices.
-    buffer_ptr tempVertexStagingBuffer = this->logicalDevice->CreateBuffer(
-        { .sizeInBytes = (sizeof(xy_rgb) * Window_Info.staticVertices.size()),
-          .usage = vk::BufferUsageFlagBits::eTransferSrc,
-          .memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible |
-                              vk::MemoryPropertyFlagBits::eHostCoherent });
-
     // Create device local buffer for static and dynamic data vertices.
+    vk::DeviceSize staticVerticesSize =
+        sizeof(xy_rgb) * Window_Info.staticVertices.size();
     this->staticVertexBuffer = this->logicalDevice->CreateBuffer(
-        { .sizeInBytes = tempVertexStagingBuffer->size +
+        { .sizeInBytes = staticVerticesSize +
                          Window_Info.sizeOfDynamicDataVerticesInBytes,
           .usage = vk::BufferUsageFlagBits::eTransferDst |
                    vk::BufferUsageFlagBits::eVertexBuffer,
-          .memoryProperties = vk::MemoryPropertyFlagBits::eDeviceLocal });
-
-    // Map static vertices to the static vertex buffer.
-    void* tempVertexStagingBufferPointer =
-        this->logicalDevice->GetHandle().mapMemory(
-            tempVertexStagingBuffer->memory.get(),
-            0,
-            tempVertexStagingBuffer->size,
-            {});
-    memcpy(tempVertexStagingBufferPointer,
-           Window_Info.staticVertices.data(),
-           static_cast<size_t>(tempVertexStagingBuffer->size));
-    this->logicalDevice->GetHandle().unmapMemory(
-        tempVertexStagingBuffer->memory.get());
-
-    // Record command buffer for transferring static vertices.
-    this->stagingCommandBuffer->begin(
-        { .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
-    this->stagingCommandBuffer->copyBuffer(
-        tempVertexStagingBuffer->handle.get(),
-        this->staticVertexBuffer->handle.get(),
-        vk::BufferCopy{ .srcOffset = 0,
-                        .dstOffset = 0,
-                        .size = tempVertexStagingBuffer->size });
-    this->stagingCommandBuffer->end();
+          .memoryProperties = vk::MemoryPropertyFlagBits::eDeviceLocal,
+          .category = memory_category::eVertex,
+          .owner = this });
+    if (this->staticVertexBuffer == nullptr) {
+        ErrorCallback("Failed to create the vertex buffer for the window.");
+        return;
+    }
 
-    // Transfer static vertex buffer data from the staging buffer to the
-    // device-local buffer.
-    vk::SubmitInfo stagingSubmitInfo = {
-        .commandBufferCount = 1,
-        .pCommandBuffers = &this->stagingCommandBuffer.get()
-    };
-    this->graphicsQueue.submit({ stagingSubmitInfo });
-    this->graphicsQueue.waitIdle();
+    // Transfer static vertices to the device local buffer, either with the
+    // uploads of other windows or on their own.
+    upload_batch_ptr uploadBatch = Window_Info.uploadBatch;
+    if (uploadBatch == nullptr) {
+        uploadBatch = Upload_Batch;
+    }
+    bool submitUploads = (uploadBatch == nullptr);
+    if (submitUploads) {
+        uploadBatch = this->logicalDevice->BeginUploadBatch();
+    }
+    uploadBatch->Upload(Window_Info.staticVertices.data(),
+                        staticVerticesSize,
+                        this->staticVertexBuffer);
+    if (submitUploads) {
+        uploadBatch->Submit();
+    }
 
     // Create vertex staging buffer.
     this->staticVertexStagingBuffer = this->logicalDevice->CreateBuffer(
         { .sizeInBytes = Window_Info.sizeOfDynamicDataVerticesInBytes,
           .usage = vk::BufferUsageFlagBits::eTransferSrc,
           .memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible |
-                              vk::MemoryPropertyFlagBits::eHostCoherent });
+                              vk::MemoryPropertyFlagBits::eHostCoherent,
+          .category = memory_category::eStaging,
+          .owner = this });
+    if (this->staticVertexStagingBuffer == nullptr) {
+        ErrorCallback(
+            "Failed to create the vertex staging buffer for the window.");
+        return;
+    }
 
     vk::CommandBufferBeginInfo stagingCommandBufferBeginInfo = {};
     this->stagingCommandBuffer->begin(stagingCommandBufferBeginInfo);
@@ -334,7 +372,7 @@ window::window(const window_info& Window_Info, window* Parent_Window)
         this->staticVertexStagingBuffer->handle.get(),
         this->staticVertexBuffer->handle.get(),
         { vk::BufferCopy{ .srcOffset = 0,
-                          .dstOffset = tempVertexStagingBuffer->size,
+                          .dstOffset = staticVerticesSize,
                           .size = this->staticVertexStagingBuffer->size } });
     this->stagingCommandBuffer->end();
 
@@ -361,9 +399,9 @@ window::window(const window_info& Window_Info, window* Parent_Window)
         finishedRenderingSemaphores.emplace_back(
             this->logicalDevice->GetHandle().createSemaphoreUnique(
                 semaphoreCreateInfo));
-        inFlightFences.emplace_back(
+        inFlightFences.emplace_back(std::make_shared<vk::UniqueFence>(
             this->logicalDevice->GetHandle().createFenceUnique(
-                fenceCreateInfo));
+                fenceCreateInfo)));
     }
 
     // Configure semaphore triggering.
@@ -372,7 +410,12 @@ window::window(const window_info& Window_Info, window* Parent_Window)
 
 window::~window()
 {
-    this->logicalDevice->GetHandle().waitIdle();
+    if (this->logicalDevice != nullptr) {
+        this->logicalDevice->WaitIdle();
+    }
+    if (this->surface) {
+        this->gvwInstance->ForgetSurface(this->surface.get());
+    }
 }
 
 void window::SetUserPointer(void* Pointer)
@@ -381,10 +424,308 @@ void window::SetUserPointer(void* Pointer)
     glfwSetWindowUserPointer(this->windowHandle, Pointer);
 }
 
+void window::PushEvent(const window_event& Event) noexcept
+{
+    window_event event = Event;
+    event.time = std::chrono::steady_clock::now();
+    this->UpdateInputState(event);
+
+    // Merge high-rate events before they reach the event ring so that its
+    // use stays bounded no matter how fast they arrive.
+    window_event_coalescing coalescing = this->GetEventCoalescing(event.type);
+    if (coalescing != window_event_coalescing::eKeepAll) {
+        std::optional<window_event>& coalescedEvent =
+            this->coalescedEvents.at(static_cast<size_t>(event.type));
+        if (coalescedEvent.has_value()) {
+            internal::CoalesceEvent(coalescedEvent.value(), event, coalescing);
+        } else {
+            coalescedEvent = event;
+        }
+        this->AwaitPollEnd();
+        return;
+    }
+
+    // Keep discrete events ordered after the coalesced events before them.
+    if (!IsContinuousEvent(event.type)) {
+        this->PushCoalescedEvents();
+    }
+
+    size_t limit = IsContinuousEvent(event.type)
+                       ? EVENT_RING_CAPACITY - DISCRETE_EVENT_RESERVE
+                       : EVENT_RING_CAPACITY;
+    if (!this->eventRing.TryPush(event, limit)) {
+        this->droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool window::IsContinuousEvent(window_event_type Type)
+{
+    switch (Type) {
+        case window_event_type::eCursorPosition:
+        case window_event_type::eScroll:
+        case window_event_type::eSize:
+        case window_event_type::eFramebufferSize:
+        case window_event_type::eContentScale:
+        case window_event_type::ePosition:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void window::UpdateInputState(const window_event& Event)
+{
+    switch (Event.type) {
+        case window_event_type::eKey: {
+            auto index = static_cast<size_t>(Event.key.key);
+            if (index >= window_input_state::KEY_COUNT) {
+                return;
+            }
+            uint64_t& word = this->pendingInputState.keys.at(
+                index / window_input_state::BITS_PER_WORD);
+            uint64_t bit = uint64_t(1)
+                           << (index % window_input_state::BITS_PER_WORD);
+            if (Event.key.action == window_key_action::eRelease) {
+                word &= ~bit;
+            } else {
+                word |= bit;
+            }
+            break;
+        }
+        case window_event_type::eMouseButton: {
+            int button = Event.mouseButton.button;
+            if (button < 0 || button > GLFW_MOUSE_BUTTON_LAST) {
+                return;
+            }
+            auto bit = uint8_t(1U << button);
+            if (Event.mouseButton.action == GLFW_RELEASE) {
+                this->pendingInputState.mouseButtons &= uint8_t(~bit);
+            } else {
+                this->pendingInputState.mouseButtons |= bit;
+            }
+            break;
+        }
+        case window_event_type::eCursorPosition:
+            this->pendingInputState.cursorPosition = Event.cursorPosition;
+            break;
+        default:
+            return;
+    }
+
+    this->AwaitPollEnd();
+}
+
+void window::PublishInputState()
+{
+    this->inputState.Store(this->pendingInputState);
+}
+
+window_event_coalescing window::GetEventCoalescing(
+    window_event_type Type) const
+{
+    switch (Type) {
+        case window_event_type::eCursorPosition:
+            return this->eventCoalescing.cursorPosition;
+        case window_event_type::eScroll:
+            return this->eventCoalescing.scroll;
+        case window_event_type::eSize:
+            return this->eventCoalescing.size;
+        case window_event_type::eFramebufferSize:
+            return this->eventCoalescing.framebufferSize;
+        case window_event_type::eContentScale:
+            return this->eventCoalescing.contentScale;
+        case window_event_type::ePosition:
+            return this->eventCoalescing.position;
+        default:
+            return window_event_coalescing::eKeepAll;
+    }
+}
+
+void window::PushCoalescedEvents()
+{
+    for (auto& coalescedEvent : this->coalescedEvents) {
+        if (coalescedEvent.has_value() &&
+            this->eventRing.TryPush(
+                coalescedEvent.value(),
+                EVENT_RING_CAPACITY - DISCRETE_EVENT_RESERVE)) {
+            coalescedEvent.reset();
+        }
+    }
+}
+
+void window::AwaitPollEnd()
+{
+    if (!this->awaitingPollEnd) {
+        this->awaitingPollEnd = true;
+        this->gvwInstance->windowsAwaitingPollEnd.push_back(this);
+    }
+}
+
+void window::FinishPoll()
+{
+    this->PushCoalescedEvents();
+    this->PublishInputState();
+    this->awaitingPollEnd = false;
+
+    // Coalesced events that did not fit are pushed after the next poll.
+    if (std::any_of(this->coalescedEvents.begin(),
+                    this->coalescedEvents.end(),
+                    [](const auto& Coalesced_Event) {
+                        return Coalesced_Event.has_value();
+                    })) {
+        this->AwaitPollEnd();
+    }
+}
+
+template<typename Event_Type>
+void window::StoreEvent(std::vector<Event_Type>& Events,
+                        std::vector<event_time>& Event_Times,
+                        const Event_Type& Event,
+                        event_time Event_Time,
+                        window_event_coalescing Coalescing)
+{
+    if (Events.empty() || Coalescing == window_event_coalescing::eKeepAll) {
+        Events.push_back(Event);
+        Event_Times.push_back(Event_Time);
+        return;
+    }
+
+    Event_Times.back() = Event_Time;
+    internal::CoalesceValue(Events.back(), Event, Coalescing);
+}
+
+void window::DrainEventRing()
+{
+    window_event event{};
+    while (this->eventRing.TryPop(event)) {
+        // Events are popped in the order they were received, so the first
+        // event read since the last presented frame is the oldest.
+        if (!this->oldestUnpresentedEventTime.has_value()) {
+            this->oldestUnpresentedEventTime = event.time;
+        }
+
+        switch (event.type) {
+            case window_event_type::eKey:
+                StoreEvent(this->events.keyEvents,
+                           this->events.keyEventTimes,
+                           event.key,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eCharacter:
+                StoreEvent(this->events.characterEvents,
+                           this->events.characterEventTimes,
+                           event.character,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eCursorPosition:
+                StoreEvent(this->events.cursorPositionEvents,
+                           this->events.cursorPositionEventTimes,
+                           event.cursorPosition,
+                           event.time,
+                           this->eventCoalescing.cursorPosition);
+                break;
+            case window_event_type::eCursorEnter:
+                StoreEvent(this->events.cursorEnterEvents,
+                           this->events.cursorEnterEventTimes,
+                           event.cursorEnter,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eMouseButton:
+                StoreEvent(this->events.mouseButtonEvents,
+                           this->events.mouseButtonEventTimes,
+                           event.mouseButton,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eScroll:
+                StoreEvent(this->events.scrollEvents,
+                           this->events.scrollEventTimes,
+                           event.scroll,
+                           event.time,
+                           this->eventCoalescing.scroll);
+                break;
+            case window_event_type::eFileDrop:
+                StoreEvent(this->events.fileDropEvents,
+                           this->events.fileDropEventTimes,
+                           event.fileDrop,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eClose:
+                ++this->events.closeEvents;
+                this->events.closeEventTimes.push_back(event.time);
+                break;
+            case window_event_type::eSize:
+                StoreEvent(this->events.sizeEvents,
+                           this->events.sizeEventTimes,
+                           event.size,
+                           event.time,
+                           this->eventCoalescing.size);
+                break;
+            case window_event_type::eFramebufferSize:
+                StoreEvent(this->events.framebufferSizeEvents,
+                           this->events.framebufferSizeEventTimes,
+                           event.framebufferSize,
+                           event.time,
+                           this->eventCoalescing.framebufferSize);
+                break;
+            case window_event_type::eContentScale:
+                StoreEvent(this->events.contentScaleEvents,
+                           this->events.contentScaleEventTimes,
+                           event.contentScale,
+                           event.time,
+                           this->eventCoalescing.contentScale);
+                break;
+            case window_event_type::ePosition:
+                StoreEvent(this->events.positionEvents,
+                           this->events.positionEventTimes,
+                           event.position,
+                           event.time,
+                           this->eventCoalescing.position);
+                break;
+            case window_event_type::eIconify:
+                StoreEvent(this->events.iconifyEvents,
+                           this->events.iconifyEventTimes,
+                           event.iconify,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eMaximize:
+                StoreEvent(this->events.maximizeEvents,
+                           this->events.maximizeEventTimes,
+                           event.maximize,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eFocus:
+                StoreEvent(this->events.focusEvents,
+                           this->events.focusEventTimes,
+                           event.focus,
+                           event.time,
+                           window_event_coalescing::eKeepAll);
+                break;
+            case window_event_type::eRefresh:
+                ++this->events.refreshEvents;
+                this->events.refreshEventTimes.push_back(event.time);
+                break;
+        }
+    }
+}
+
 void window::CreateSwapchain()
+{
+    window_size framebufferSize = internal::RunOnMainThread(
+        [this]() { return this->GetFramebufferSizeNoMutex(); });
+    this->CreateSwapchain(framebufferSize);
+}
+
+void window::CreateSwapchain(const window_size& Framebuffer_Size)
 {
     this->swapchain = this->logicalDevice->CreateSwapchain(
-        { .framebufferSize = this->GetFramebufferSizeNoMutex(),
+        { .framebufferSize = Framebuffer_Size,
           .graphicsQueueIndex = this->graphicsQueueIndex,
           .presentQueueIndex = this->presentQueueIndex,
           .surface = this->surface.get(),
@@ -397,20 +738,23 @@ void window::CreatePipeline(const pipeline_dynamic_states& Dynamic_States)
     this->pipeline = this->logicalDevice->CreatePipeline(
         { .shaders = this->shaders,
           .dynamicStates = Dynamic_States,
-          .renderPass = this->renderPass->handle.get() });
+          .renderPass = this->renderPass });
 }
 
-void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
+void window::WaitForFrame()
 {
     // Wait until the previous frame is done rendering.
     if (logicalDevice->GetHandle().waitForFences(
-            this->inFlightFences.at(this->currentFrameIndex).get(),
+            this->inFlightFences.at(this->currentFrameIndex)->get(),
             VK_TRUE,
             UINT64_MAX) != vk::Result::eSuccess) {
         ErrorCallback("Failed to wait for the previous "
                       "frame to finish rendering.");
     }
+}
 
+std::optional<uint32_t> window::AcquireFrameImage()
+{
     // Get an image from the swapchain to render to.
     vk::ResultValue<uint32_t> imageIndex =
         logicalDevice->GetHandle().acquireNextImageKHR(
@@ -419,175 +763,230 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
             nextImageAvailableSemaphores.at(currentFrameIndex).get());
 
     if (imageIndex.result == vk::Result::eErrorOutOfDateKHR) {
-        logicalDevice->GetHandle().waitIdle();
+        logicalDevice->WaitIdle();
         this->CreateSwapchain();
-    } else if (imageIndex.result != vk::Result::eSuccess &&
-               imageIndex.result != vk::Result::eSuboptimalKHR) {
+        return std::nullopt;
+    }
+    if (imageIndex.result != vk::Result::eSuccess &&
+        imageIndex.result != vk::Result::eSuboptimalKHR) {
         ErrorCallback("Failed to acquire next image from the swapchain.");
-    } else {
-        logicalDevice->GetHandle().resetFences(
-            inFlightFences.at(currentFrameIndex).get());
-
-        // Map vertices to the vertex buffer.
-        void* vertexStagingBufferPointer =
-            this->logicalDevice->GetHandle().mapMemory(
-                this->staticVertexStagingBuffer->memory.get(),
-                0,
-                this->staticVertexStagingBuffer->size,
-                {});
-        memcpy(vertexStagingBufferPointer,
-               Vertices.data(),
-               static_cast<size_t>(this->staticVertexStagingBuffer->size));
-        this->logicalDevice->GetHandle().unmapMemory(
-            this->staticVertexStagingBuffer->memory.get());
-
-        // Transfer vertex buffer data from the staging buffer to the
-        // destination buffer.
-        vk::SubmitInfo stagingSubmitInfo = {
-            .commandBufferCount = 1,
-            .pCommandBuffers = &this->stagingCommandBuffer.get()
-        };
-        this->graphicsQueue.submit({ stagingSubmitInfo });
-        this->graphicsQueue.waitIdle();
+        return std::nullopt;
+    }
+    return imageIndex.value;
+}
 
-        // Use the command buffer to record drawing commands.
-        vk::CommandBuffer commandBuffer =
-            commandBuffers.at(currentFrameIndex).get();
-        commandBuffer.reset();
+void window::RecordFrame(uint32_t Image_Index,
+                         const std::vector<xy_rgb>& Vertices)
+{
+    // Copy vertices to the persistently mapped staging buffer. The previous
+    // transfer from it has completed because its frame fence was waited on.
+    memcpy(this->staticVertexStagingBuffer->allocation->GetMappedData(),
+           Vertices.data(),
+           static_cast<size_t>(this->staticVertexStagingBuffer->size));
 
-        vk::CommandBufferBeginInfo commandBufferBeginInfo = {
-            .pInheritanceInfo = nullptr // optional
-        };
-        commandBuffer.begin(commandBufferBeginInfo);
-
-        vk::ClearColorValue clearColor = { 0.0F, 0.0F, 0.0F, 1.0F };
-        vk::ClearValue clearValue(clearColor);
-
-        vk::RenderPassBeginInfo renderPassBeginInfo = {
-            .renderPass = this->renderPass->handle.get(),
-            .framebuffer =
-                this->swapchain->swapchainFramebuffers.at(imageIndex.value)
-                    .get(),
-            .renderArea = { .offset = { 0, 0 },
-                            .extent = this->swapchain->scissor.extent },
-            .clearValueCount = 1,
-            .pClearValues = &clearValue
-        };
+    // Use the command buffer to record drawing commands.
+    vk::CommandBuffer commandBuffer =
+        commandBuffers.at(currentFrameIndex).get();
+    commandBuffer.reset();
 
-        // Record the render pass in the command buffer.
-        commandBuffer.beginRenderPass(renderPassBeginInfo,
-                                      vk::SubpassContents::eInline);
-        commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics,
-                                   this->pipeline->handle.get());
-        commandBuffer.setViewport(0, this->swapchain->viewport);
-        commandBuffer.setScissor(0, this->swapchain->scissor);
-        commandBuffer.bindVertexBuffers(
-            0, { this->staticVertexBuffer->handle.get() }, { 0 });
-        commandBuffer.draw(
-            static_cast<uint32_t>(this->staticVertexBuffer->size), 1, 0, 0);
-        commandBuffer.endRenderPass();
-
-        commandBuffer.end();
-
-        vk::SubmitInfo submitInfo = {
-            .waitSemaphoreCount = 1,
-            .pWaitSemaphores =
-                &nextImageAvailableSemaphores.at(currentFrameIndex).get(),
-            .pWaitDstStageMask = waitStages.data(),
-            .commandBufferCount = 1,
-            .pCommandBuffers = &commandBuffer,
-            .signalSemaphoreCount = 1,
-            .pSignalSemaphores =
-                &finishedRenderingSemaphores.at(currentFrameIndex).get()
-        };
+    vk::CommandBufferBeginInfo commandBufferBeginInfo = {
+        .pInheritanceInfo = nullptr // optional
+    };
+    commandBuffer.begin(commandBufferBeginInfo);
 
-        // Submit the command buffer to the graphics queue.
-        graphicsQueue.submit(submitInfo,
-                             inFlightFences.at(currentFrameIndex).get());
-
-        // Configure presentation.
-        vk::PresentInfoKHR presentInfo = {
-            .waitSemaphoreCount = 1,
-            .pWaitSemaphores =
-                &finishedRenderingSemaphores.at(currentFrameIndex).get(),
-            .swapchainCount = 1,
-            .pSwapchains = &this->swapchain->handle.get(),
-            .pImageIndices = &imageIndex.value,
-            .pResults = nullptr // optional
-        };
+    // The staging command buffer is submitted before this one. Make its
+    // transfer visible to the vertex input stage.
+    vk::MemoryBarrier vertexTransferBarrier = {
+        .srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+        .dstAccessMask = vk::AccessFlagBits::eVertexAttributeRead
+    };
+    commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer,
+                                  vk::PipelineStageFlagBits::eVertexInput,
+                                  {},
+                                  vertexTransferBarrier,
+                                  nullptr,
+                                  nullptr);
+
+    vk::ClearColorValue clearColor = { 0.0F, 0.0F, 0.0F, 1.0F };
+    vk::ClearValue clearValue(clearColor);
+
+    vk::RenderPassBeginInfo renderPassBeginInfo = {
+        .renderPass = this->renderPass->handle.get(),
+        .framebuffer =
+            this->swapchain->swapchainFramebuffers.at(Image_Index).get(),
+        .renderArea = { .offset = { 0, 0 },
+                        .extent = this->swapchain->scissor.extent },
+        .clearValueCount = 1,
+        .pClearValues = &clearValue
+    };
 
-        // Presents the rendered image to the swapchain which is then
-        // displayed on the window surface.
-        vk::Result presentResult = presentQueue.presentKHR(&presentInfo);
-        if (presentResult == vk::Result::eErrorOutOfDateKHR ||
-            presentResult == vk::Result::eSuboptimalKHR) {
-            logicalDevice->GetHandle().waitIdle();
-            this->CreateSwapchain();
-        } else if (presentResult != vk::Result::eSuccess) {
-            ErrorCallback("Presentation failed.");
+    // Record the render pass in the command buffer.
+    commandBuffer.beginRenderPass(renderPassBeginInfo,
+                                  vk::SubpassContents::eInline);
+    commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics,
+                               this->pipeline->handle.get());
+    commandBuffer.setViewport(0, this->swapchain->viewport);
+    commandBuffer.setScissor(0, this->swapchain->scissor);
+    commandBuffer.bindVertexBuffers(
+        0, { this->staticVertexBuffer->handle.get() }, { 0 });
+    commandBuffer.draw(
+        static_cast<uint32_t>(this->staticVertexBuffer->size), 1, 0, 0);
+    commandBuffer.endRenderPass();
+
+    commandBuffer.end();
+
+    this->frameCommandBuffers = { this->stagingCommandBuffer.get(),
+                                  commandBuffer };
+    this->frameImageIndex = Image_Index;
+}
+
+vk::SubmitInfo window::GetFrameSubmitInfo() const
+{
+    return { .waitSemaphoreCount = 1,
+             .pWaitSemaphores =
+                 &nextImageAvailableSemaphores.at(currentFrameIndex).get(),
+             .pWaitDstStageMask = waitStages.data(),
+             .commandBufferCount =
+                 static_cast<uint32_t>(this->frameCommandBuffers.size()),
+             .pCommandBuffers = this->frameCommandBuffers.data(),
+             .signalSemaphoreCount = 1,
+             .pSignalSemaphores =
+                 &finishedRenderingSemaphores.at(currentFrameIndex).get() };
+}
+
+void window::EndFrame(vk::Result Present_Result)
+{
+    if (Present_Result == vk::Result::eErrorOutOfDateKHR ||
+        Present_Result == vk::Result::eSuboptimalKHR) {
+        logicalDevice->WaitIdle();
+        this->CreateSwapchain();
+    } else if (Present_Result != vk::Result::eSuccess) {
+        ErrorCallback("Presentation failed.");
+    }
+
+    {
+        // Attribute the events read since the last presented frame to this
+        // frame.
+        std::scoped_lock lock(this->eventsMutex);
+        if (this->oldestUnpresentedEventTime.has_value()) {
+            std::chrono::nanoseconds latency =
+                std::chrono::steady_clock::now() -
+                this->oldestUnpresentedEventTime.value();
+            ++this->inputLatency.frameCount;
+            this->inputLatency.lastLatency = latency;
+            this->inputLatency.maxLatency =
+                std::max(this->inputLatency.maxLatency, latency);
+            this->inputLatency.totalLatency += latency;
+            this->oldestUnpresentedEventTime.reset();
         }
+    }
+
+    currentFrameIndex = (currentFrameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+}
 
-        currentFrameIndex = (currentFrameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
+{
+    this->WaitForFrame();
+    std::optional<uint32_t> imageIndex = this->AcquireFrameImage();
+    if (!imageIndex.has_value()) {
+        return;
     }
+
+    // The fence may be shared with windows drawn by `instance::DrawFrames`.
+    // Resetting a shared fence would stall those windows, so replace it.
+    std::shared_ptr<vk::UniqueFence>& inFlightFence =
+        this->inFlightFences.at(currentFrameIndex);
+    if (inFlightFence.use_count() == 1) {
+        logicalDevice->GetHandle().resetFences(inFlightFence->get());
+    } else {
+        inFlightFence = std::make_shared<vk::UniqueFence>(
+            logicalDevice->GetHandle().createFenceUnique({}));
+    }
+
+    this->RecordFrame(imageIndex.value(), Vertices);
+
+    // Submit the command buffers to the graphics queue.
+    this->graphicsQueue->Submit(this->GetFrameSubmitInfo(),
+                                inFlightFence->get());
+
+    // Configure presentation.
+    vk::PresentInfoKHR presentInfo = {
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores =
+            &finishedRenderingSemaphores.at(currentFrameIndex).get(),
+        .swapchainCount = 1,
+        .pSwapchains = &this->swapchain->handle.get(),
+        .pImageIndices = &this->frameImageIndex,
+        .pResults = nullptr // optional
+    };
+
+    // Presents the rendered image to the swapchain which is then
+    // displayed on the window surface.
+    this->EndFrame(this->presentQueue->Present(presentInfo));
 }
 
 int window::GetWindowAttribute(int Attribute)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return glfwGetWindowAttrib(this->windowHandle, Attribute);
+    return internal::RunOnMainThread([&]() {
+        return glfwGetWindowAttrib(this->windowHandle, Attribute);
+    });
 }
 
 void window::SetWindowAttribute(int Attribute, int Value)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowAttrib(this->windowHandle, Attribute, Value);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowAttrib(this->windowHandle, Attribute, Value);
+    });
 }
 
 void window::SetInputMode(int Mode, int Value)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetInputMode(this->windowHandle, Mode, Value);
+    internal::RunOnMainThread([&]() {
+        glfwSetInputMode(this->windowHandle, Mode, Value);
+    });
 }
 
 int window::GetInputMode(int Mode)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return glfwGetInputMode(this->windowHandle, Mode);
+    return internal::RunOnMainThread([&]() {
+        return glfwGetInputMode(this->windowHandle, Mode);
+    });
 }
 
 void window::SetEventCallbacksNoMutex(
-    const window_event_callbacks& Window_Event_Callbacks) const
+    GLFWwindow* Window_Handle,
+    const window_event_callbacks& Window_Event_Callbacks)
 {
-    glfwSetKeyCallback(this->windowHandle, Window_Event_Callbacks.keyCallback);
-    glfwSetCharCallback(this->windowHandle,
+    glfwSetKeyCallback(Window_Handle, Window_Event_Callbacks.keyCallback);
+    glfwSetCharCallback(Window_Handle,
                         Window_Event_Callbacks.characterCallback);
-    glfwSetCursorPosCallback(this->windowHandle,
+    glfwSetCursorPosCallback(Window_Handle,
                              Window_Event_Callbacks.cursorPositionCallback);
-    glfwSetCursorEnterCallback(this->windowHandle,
+    glfwSetCursorEnterCallback(Window_Handle,
                                Window_Event_Callbacks.cursorEnterCallback);
-    glfwSetMouseButtonCallback(this->windowHandle,
+    glfwSetMouseButtonCallback(Window_Handle,
                                Window_Event_Callbacks.mouseButtonCallback);
-    glfwSetScrollCallback(this->windowHandle,
+    glfwSetScrollCallback(Window_Handle,
                           Window_Event_Callbacks.scrollCallback);
-    glfwSetDropCallback(this->windowHandle,
+    glfwSetDropCallback(Window_Handle,
                         Window_Event_Callbacks.fileDropCallback);
-    glfwSetWindowCloseCallback(this->windowHandle,
+    glfwSetWindowCloseCallback(Window_Handle,
                                Window_Event_Callbacks.closeCallback);
-    glfwSetWindowSizeCallback(this->windowHandle,
+    glfwSetWindowSizeCallback(Window_Handle,
                               Window_Event_Callbacks.sizeCallback);
     glfwSetFramebufferSizeCallback(
-        this->windowHandle, Window_Event_Callbacks.framebufferSizeCallback);
+        Window_Handle, Window_Event_Callbacks.framebufferSizeCallback);
     glfwSetWindowContentScaleCallback(
-        this->windowHandle, Window_Event_Callbacks.contentScaleCallback);
-    glfwSetWindowPosCallback(this->windowHandle,
+        Window_Handle, Window_Event_Callbacks.contentScaleCallback);
+    glfwSetWindowPosCallback(Window_Handle,
                              Window_Event_Callbacks.positionCallback);
-    glfwSetWindowIconifyCallback(this->windowHandle,
+    glfwSetWindowIconifyCallback(Window_Handle,
                                  Window_Event_Callbacks.iconifyCallback);
-    glfwSetWindowMaximizeCallback(this->windowHandle,
+    glfwSetWindowMaximizeCallback(Window_Handle,
                                   Window_Event_Callbacks.maximizeCallback);
-    glfwSetWindowFocusCallback(this->windowHandle,
+    glfwSetWindowFocusCallback(Window_Handle,
                                Window_Event_Callbacks.focusCallback);
-    glfwSetWindowRefreshCallback(this->windowHandle,
+    glfwSetWindowRefreshCallback(Window_Handle,
                                  Window_Event_Callbacks.refreshCallback);
 }
 
@@ -634,8 +1033,30 @@ void window::ShowNoMutex() const
 
 void window::SetEventCallbacks(const window_event_callbacks& Event_Callbacks)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    this->SetEventCallbacksNoMutex(Event_Callbacks);
+    internal::RunOnMainThread([&]() {
+        SetEventCallbacksNoMutex(this->windowHandle, Event_Callbacks);
+
+        this->keyStateTracked =
+            (Event_Callbacks.keyCallback ==
+             window_key_event_callback_config::APPEND_TO_KEY_EVENT_BUFFER);
+        this->mouseButtonStateTracked =
+            (Event_Callbacks.mouseButtonCallback ==
+             window_mouse_button_event_callback_config::
+                 APPEND_TO_MOUSE_BUTTON_EVENT_BUFFER);
+        this->cursorPositionTracked =
+            (Event_Callbacks.cursorPositionCallback ==
+             window_cursor_position_event_callback_config::
+                 APPEND_TO_CURSOR_POSITION_EVENT_BUFFER);
+
+        // The cursor position callback only reports movement, so start from the
+        // current position.
+        if (this->cursorPositionTracked) {
+            glfwGetCursorPos(this->windowHandle,
+                             &this->pendingInputState.cursorPosition.x,
+                             &this->pendingInputState.cursorPosition.y);
+            this->PublishInputState();
+        }
+    });
 }
 
 window_ptr window::CreateChildWindow(const window_info& Window_Info)
@@ -651,226 +1072,307 @@ GLFWwindow* window::GetHandle() const noexcept
 
 std::vector<window_key_event> window::GetKeyEvents() noexcept
 {
-    std::scoped_lock lock(this->keyEventsMutex);
-    return this->keyEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.keyEvents;
 }
 
 std::vector<window_character_event> window::GetCharacterEvents() noexcept
 {
-    std::scoped_lock lock(this->characterEventsMutex);
-    return this->characterEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.characterEvents;
 }
 
 std::vector<window_cursor_position_event>
 window::GetCursorPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorPositionEventsMutex);
-    return this->cursorPositionEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.cursorPositionEvents;
 }
 
 std::vector<window_cursor_enter_event> window::GetCursorEnterEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorEnterEventsMutex);
-    return this->cursorEnterEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.cursorEnterEvents;
 }
 
 std::vector<window_mouse_button_event> window::GetMouseButtonEvents() noexcept
 {
-    std::scoped_lock lock(this->mouseButtonEventsMutex);
-    return this->mouseButtonEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.mouseButtonEvents;
 }
 
 std::vector<window_scroll_event> window::GetScrollEvents() noexcept
 {
-    std::scoped_lock lock(this->scrollEventsMutex);
-    return this->scrollEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.scrollEvents;
 }
 
 std::vector<window_file_drop_event> window::GetFileDropEvents() noexcept
 {
-    std::scoped_lock lock(this->fileDropEventsMutex);
-    return this->fileDropEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.fileDropEvents;
 }
 
 [[nodiscard]] size_t window::GetCloseEvents() noexcept
 {
-    std::scoped_lock lock(this->closeEventsMutex);
-    return this->closeEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.closeEvents;
 }
 
 [[nodiscard]] std::vector<window_size_event> window::GetSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->sizeEventsMutex);
-    return this->sizeEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.sizeEvents;
 }
 
 [[nodiscard]] std::vector<window_framebuffer_size_event>
 window::GetFramebufferSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->framebufferSizeEventsMutex);
-    return this->framebufferSizeEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.framebufferSizeEvents;
 }
 
 [[nodiscard]] std::vector<window_content_scale_event>
 window::GetContentScaleEvents() noexcept
 {
-    std::scoped_lock lock(this->contentScaleEventsMutex);
-    return this->contentScaleEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.contentScaleEvents;
 }
 
 [[nodiscard]] std::vector<window_position_event>
 window::GetPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->positionEventsMutex);
-    return this->positionEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.positionEvents;
 }
 
 [[nodiscard]] std::vector<window_iconify_event>
 window::GetIconifyEvents() noexcept
 {
-    std::scoped_lock lock(this->iconifyEventsMutex);
-    return this->iconifyEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.iconifyEvents;
 }
 
 [[nodiscard]] std::vector<window_maximize_event>
 window::GetMaximizeEvents() noexcept
 {
-    std::scoped_lock lock(this->maximizeEventsMutex);
-    return this->maximizeEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.maximizeEvents;
 }
 
 [[nodiscard]] std::vector<window_focus_event> window::GetFocusEvents() noexcept
 {
-    std::scoped_lock lock(this->focusEventsMutex);
-    return this->focusEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.focusEvents;
 }
 
 [[nodiscard]] size_t window::GetRefreshEvents() noexcept
 {
-    std::scoped_lock lock(this->refreshEventsMutex);
-    return this->refreshEvents;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    return this->events.refreshEvents;
 }
 
 void window::ClearKeyEvents() noexcept
 {
-    std::scoped_lock lock(this->keyEventsMutex);
-    this->keyEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.keyEvents.clear();
+    this->events.keyEventTimes.clear();
 }
 
 void window::ClearCharacterEvents() noexcept
 {
-    std::scoped_lock lock(this->characterEventsMutex);
-    this->characterEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.characterEvents.clear();
+    this->events.characterEventTimes.clear();
 }
 
 void window::ClearCursorPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorPositionEventsMutex);
-    this->cursorPositionEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.cursorPositionEvents.clear();
+    this->events.cursorPositionEventTimes.clear();
 }
 
 void window::ClearCursorEnterEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorEnterEventsMutex);
-    this->cursorEnterEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.cursorEnterEvents.clear();
+    this->events.cursorEnterEventTimes.clear();
 }
 
 void window::ClearMouseButtonEvents() noexcept
 {
-    std::scoped_lock lock(this->mouseButtonEventsMutex);
-    this->mouseButtonEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.mouseButtonEvents.clear();
+    this->events.mouseButtonEventTimes.clear();
 }
 
 void window::ClearScrollEvents() noexcept
 {
-    std::scoped_lock lock(this->scrollEventsMutex);
-    this->scrollEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.scrollEvents.clear();
+    this->events.scrollEventTimes.clear();
 }
 
 void window::ClearFileDropEvents() noexcept
 {
-    std::scoped_lock lock(this->fileDropEventsMutex);
-    this->fileDropEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.fileDropEvents.clear();
+    this->events.fileDropEventTimes.clear();
 }
 
 void window::ClearCloseEvents() noexcept
 {
-    std::scoped_lock lock(this->closeEventsMutex);
-    this->closeEvents = 0;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.closeEvents = 0;
+    this->events.closeEventTimes.clear();
 }
 
 void window::ClearSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->sizeEventsMutex);
-    this->sizeEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.sizeEvents.clear();
+    this->events.sizeEventTimes.clear();
 }
 
 void window::ClearFramebufferSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->framebufferSizeEventsMutex);
-    this->framebufferSizeEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.framebufferSizeEvents.clear();
+    this->events.framebufferSizeEventTimes.clear();
 }
 
 void window::ClearContentScaleEvents() noexcept
 {
-    std::scoped_lock lock(this->contentScaleEventsMutex);
-    this->contentScaleEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.contentScaleEvents.clear();
+    this->events.contentScaleEventTimes.clear();
 }
 
 void window::ClearPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->positionEventsMutex);
-    this->positionEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.positionEvents.clear();
+    this->events.positionEventTimes.clear();
 }
 
 void window::ClearIconifyEvents() noexcept
 {
-    std::scoped_lock lock(this->iconifyEventsMutex);
-    this->iconifyEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.iconifyEvents.clear();
+    this->events.iconifyEventTimes.clear();
 }
 
 void window::ClearMaximizeEvents() noexcept
 {
-    std::scoped_lock lock(this->maximizeEventsMutex);
-    this->maximizeEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.maximizeEvents.clear();
+    this->events.maximizeEventTimes.clear();
 }
 
 void window::ClearFocusEvents() noexcept
 {
-    std::scoped_lock lock(this->focusEventsMutex);
-    this->focusEvents.clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.focusEvents.clear();
+    this->events.focusEventTimes.clear();
 }
 
 void window::ClearRefreshEvents() noexcept
 {
-    std::scoped_lock lock(this->refreshEventsMutex);
-    this->refreshEvents = 0;
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.refreshEvents = 0;
+    this->events.refreshEventTimes.clear();
 }
 
 void window::ClearEvents() noexcept
 {
-    this->ClearKeyEvents();
-    this->ClearCharacterEvents();
-    this->ClearCursorPositionEvents();
-    this->ClearCursorEnterEvents();
-    this->ClearMouseButtonEvents();
-    this->ClearScrollEvents();
-    this->ClearFileDropEvents();
-    this->ClearCloseEvents();
-    this->ClearSizeEvents();
-    this->ClearFramebufferSizeEvents();
-    this->ClearContentScaleEvents();
-    this->ClearPositionEvents();
-    this->ClearIconifyEvents();
-    this->ClearMaximizeEvents();
-    this->ClearFocusEvents();
-    this->ClearRefreshEvents();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    this->events.Clear();
+}
+
+void window::DrainEvents(window_events& Events) noexcept
+{
+    Events.Clear();
+    std::scoped_lock lock(this->eventsMutex);
+    this->DrainEventRing();
+    std::swap(this->events, Events);
+}
+
+size_t window::GetDroppedEventCount() const noexcept
+{
+    return this->droppedEventCount.load(std::memory_order_relaxed);
+}
+
+window_input_latency window::GetInputLatency()
+{
+    std::scoped_lock lock(this->eventsMutex);
+    return this->inputLatency;
+}
+
+void window::ResetInputLatency()
+{
+    std::scoped_lock lock(this->eventsMutex);
+    this->inputLatency = {};
+}
+
+window_input_state window::GetInputState() const noexcept
+{
+    return this->inputState.Load();
 }
 
 window_key_action window::GetKeyState(window_key Key)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return window_key_action(glfwGetKey(this->windowHandle, int(Key)));
+    if (this->keyStateTracked) {
+        return this->inputState.Load().IsKeyPressed(Key)
+                   ? window_key_action::ePress
+                   : window_key_action::eRelease;
+    }
+    return internal::RunOnMainThread([&]() {
+        return window_key_action(glfwGetKey(this->windowHandle, int(Key)));
+    });
+}
+
+bool window::IsMouseButtonPressed(int Button)
+{
+    if (this->mouseButtonStateTracked) {
+        return this->inputState.Load().IsMouseButtonPressed(Button);
+    }
+    return internal::RunOnMainThread([&]() {
+        return glfwGetMouseButton(this->windowHandle, Button) == GLFW_PRESS;
+    });
 }
 
 bool window::IsKeyPressed(window_key Key)
@@ -890,16 +1392,22 @@ bool window::IsKeyRepeating(window_key Key)
 
 coordinate<double> window::GetCursorPosition()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    coordinate<double> cursorPosition = { 0, 0 };
-    glfwGetCursorPos(this->windowHandle, &cursorPosition.x, &cursorPosition.y);
-    return cursorPosition;
+    if (this->cursorPositionTracked) {
+        return this->inputState.Load().cursorPosition;
+    }
+    return internal::RunOnMainThread([&]() {
+        coordinate<double> cursorPosition = { 0, 0 };
+        glfwGetCursorPos(
+            this->windowHandle, &cursorPosition.x, &cursorPosition.y);
+        return cursorPosition;
+    });
 }
 
 void window::SetCursorPosition(coordinate<double> Position)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetCursorPos(this->windowHandle, Position.x, Position.y);
+    internal::RunOnMainThread([&]() {
+        glfwSetCursorPos(this->windowHandle, Position.x, Position.y);
+    });
 }
 
 bool window::ShouldClose()
@@ -921,58 +1429,66 @@ void window::ShouldClose(bool State)
 
 gvw::area<int> window::GetSize()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return this->GetSizeNoMutex();
+    return internal::RunOnMainThread([&]() {
+        return this->GetSizeNoMutex();
+    });
 }
 
 void window::SetSize(const area<int>& Size)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    this->SetSizeNoMutex(Size);
+    internal::RunOnMainThread([&]() {
+        this->SetSizeNoMutex(Size);
+    });
 }
 
 gvw::area<int> window::GetFramebufferSize()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return this->GetFramebufferSizeNoMutex();
+    return internal::RunOnMainThread([&]() {
+        return this->GetFramebufferSizeNoMutex();
+    });
 }
 
 gvw::coordinate<int> window::GetPosition()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return this->GetPositionNoMutex();
+    return internal::RunOnMainThread([&]() {
+        return this->GetPositionNoMutex();
+    });
 }
 
 void window::SetPosition(const coordinate<int>& Position)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    this->SetPositionNoMutex(Position);
+    internal::RunOnMainThread([&]() {
+        this->SetPositionNoMutex(Position);
+    });
 }
 
 gvw::coordinate<float> window::GetContentScale()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    coordinate<float> contentScale = { 0.0F, 0.0F };
-    glfwGetWindowContentScale(
-        this->windowHandle, &contentScale.x, &contentScale.y);
-    return contentScale;
+    return internal::RunOnMainThread([&]() {
+        coordinate<float> contentScale = { 0.0F, 0.0F };
+        glfwGetWindowContentScale(
+            this->windowHandle, &contentScale.x, &contentScale.y);
+        return contentScale;
+    });
 }
 
 void window::SetSizeLimits(const area<int>& Minimum_Size,
                            const area<int>& Maximum_Size)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowSizeLimits(this->windowHandle,
-                            Minimum_Size.width,
-                            Minimum_Size.height,
-                            Maximum_Size.width,
-                            Maximum_Size.height);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowSizeLimits(this->windowHandle,
+                                Minimum_Size.width,
+                                Minimum_Size.height,
+                                Maximum_Size.width,
+                                Maximum_Size.height);
+    });
 }
 
 void window::SetAspectRatio(int Numerator, int Denominator)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowAspectRatio(this->windowHandle, Numerator, Denominator);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowAspectRatio(this->windowHandle, Numerator, Denominator);
+    });
 }
 
 bool window::IsCursorHovering()
@@ -1032,14 +1548,16 @@ bool window::IsAlwaysOnTop()
 
 void window::Restore()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwRestoreWindow(this->windowHandle);
+    internal::RunOnMainThread([&]() {
+        glfwRestoreWindow(this->windowHandle);
+    });
 }
 
 void window::Minimize()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwIconifyWindow(this->windowHandle);
+    internal::RunOnMainThread([&]() {
+        glfwIconifyWindow(this->windowHandle);
+    });
 }
 
 bool window::IsMinimized()
@@ -1049,8 +1567,9 @@ bool window::IsMinimized()
 
 void window::Maximize()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwMaximizeWindow(this->windowHandle);
+    internal::RunOnMainThread([&]() {
+        glfwMaximizeWindow(this->windowHandle);
+    });
 }
 
 bool window::IsMaximized()
@@ -1060,14 +1579,16 @@ bool window::IsMaximized()
 
 void window::Hide()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    this->HideNoMutex();
+    internal::RunOnMainThread([&]() {
+        this->HideNoMutex();
+    });
 }
 
 void window::Show()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    this->ShowNoMutex();
+    internal::RunOnMainThread([&]() {
+        this->ShowNoMutex();
+    });
 }
 
 bool window::IsVisible()
@@ -1077,14 +1598,16 @@ bool window::IsVisible()
 
 void window::RequestAttention()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwRequestWindowAttention(this->windowHandle);
+    internal::RunOnMainThread([&]() {
+        glfwRequestWindowAttention(this->windowHandle);
+    });
 }
 
 void window::Focus()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwFocusWindow(this->windowHandle);
+    internal::RunOnMainThread([&]() {
+        glfwFocusWindow(this->windowHandle);
+    });
 }
 
 bool window::IsFocused()
@@ -1109,14 +1632,16 @@ bool window::IsFocusedOnShow()
 
 float window::GetOpacity()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return glfwGetWindowOpacity(this->windowHandle);
+    return internal::RunOnMainThread([&]() {
+        return glfwGetWindowOpacity(this->windowHandle);
+    });
 }
 
 void window::SetOpacity(float Opacity)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowOpacity(this->windowHandle, Opacity);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowOpacity(this->windowHandle, Opacity);
+    });
 }
 
 bool window::IsTransparent()
@@ -1128,40 +1653,41 @@ bool window::IsTransparent()
 void window::EnterFullScreen(const monitor_ptr& Full_Screen_Monitor,
                              const GLFWvidmode* Video_Mode)
 {
-    /// @todo Avoid deadlock here.
-    this->resetMutex.lock();
-    this->resetPosition = this->GetPosition();
-    this->resetSize = this->GetSize();
-    this->resetMutex.unlock();
     const GLFWvidmode* videoMode = Video_Mode == nullptr
                                        ? Full_Screen_Monitor->GetVideoMode()
                                        : Video_Mode;
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowMonitor(this->windowHandle,
-                         Full_Screen_Monitor->GetHandle(),
-                         GLFW_FALSE,
-                         GLFW_FALSE,
-                         videoMode->width,
-                         videoMode->height,
-                         videoMode->refreshRate);
+    internal::RunOnMainThread([&]() {
+        {
+            std::scoped_lock lock(this->resetMutex);
+            this->resetPosition = this->GetPositionNoMutex();
+            this->resetSize = this->GetSizeNoMutex();
+        }
+        glfwSetWindowMonitor(this->windowHandle,
+                             Full_Screen_Monitor->GetHandle(),
+                             GLFW_FALSE,
+                             GLFW_FALSE,
+                             videoMode->width,
+                             videoMode->height,
+                             videoMode->refreshRate);
+    });
 }
 
 void window::ExitFullScreen(const std::optional<coordinate<int>>& Position,
                             const std::optional<area<int>>& Size)
 {
-    /// @todo Avoid deadlock here.
     this->resetMutex.lock();
-    const coordinate<int>& position = Position.value_or(this->resetPosition);
-    const area<int>& size = Size.value_or(this->resetSize);
+    const coordinate<int> position = Position.value_or(this->resetPosition);
+    const area<int> size = Size.value_or(this->resetSize);
     this->resetMutex.unlock();
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowMonitor(this->windowHandle,
-                         nullptr,
-                         position.x,
-                         position.y,
-                         size.width,
-                         size.height,
-                         GLFW_FALSE);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowMonitor(this->windowHandle,
+                             nullptr,
+                             position.x,
+                             position.y,
+                             size.width,
+                             size.height,
+                             GLFW_FALSE);
+    });
 }
 
 void window::SetCursorShape(const cursor_ptr& Cursor) // NOLINT
@@ -1170,15 +1696,17 @@ void window::SetCursorShape(const cursor_ptr& Cursor) // NOLINT
         ErrorCallback("Failed to set cursor. Cursor pointer is NULL.");
         return;
     }
-    this->cursor = Cursor;
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetCursor(this->windowHandle, this->cursor->handle);
+    internal::RunOnMainThread([&]() {
+        this->cursor = Cursor;
+        glfwSetCursor(this->windowHandle, this->cursor->handle);
+    });
 }
 
 void window::ResetCursorShape()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetCursor(this->windowHandle, nullptr);
+    internal::RunOnMainThread([&]() {
+        glfwSetCursor(this->windowHandle, nullptr);
+    });
 }
 
 void window::HideCursor()
@@ -1280,14 +1808,16 @@ void window::SetIcon(const image_ptr& Icon)
     GLFWimage iconImage = { .width = Icon->size.width,
                             .height = Icon->size.height,
                             .pixels = Icon->data };
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowIcon(this->windowHandle, 1, &iconImage);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowIcon(this->windowHandle, 1, &iconImage);
+    });
 }
 
 void window::ResetIcon()
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowIcon(this->windowHandle, 0, nullptr);
+    internal::RunOnMainThread([&]() {
+        glfwSetWindowIcon(this->windowHandle, 0, nullptr);
+    });
 }
 
 } // namespace gvw
\ No newline at end of file
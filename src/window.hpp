@@ -7,11 +7,19 @@
  * @date 2023-05-22
  */
 
+// Standard includes
+#include <array>
+#include <atomic>
+#include <optional>
+
 // Local includes
 #include "gvw.ipp"
 
 namespace gvw {
 
+/// @remark GLFW requires windows to be controlled from the thread that created
+/// the GVW instance. Methods called from other threads are forwarded to that
+/// thread and return once it next polls events.
 class window : public internal::uncopyable_unmovable // NOLINT
 {
     friend internal::window_public_constructor;
@@ -25,8 +33,12 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Creates a window.
     /// @remark This constructor is made private to prevent if from being called
     /// from outside of GVW.
+    /// @remark If `Create_Vulkan_Objects` is false, only the GLFW window and
+    /// its surface are created and `CreateVulkanObjects` must be called before
+    /// the window is used.
     window(const window_info& Window_Info = window_info_config::DEFAULT,
-           window* Parent_Window = nullptr);
+           window* Parent_Window = nullptr,
+           bool Create_Vulkan_Objects = true);
 
   public:
     // The destructor is public to allow explicit destruction.
@@ -37,8 +49,11 @@ class window : public internal::uncopyable_unmovable // NOLINT
     ///                        Private Static Functions                      ///
     ////////////////////////////////////////////////////////////////////////////
 
-    /// @brief Destroys the GLFW window.
-    static void DestroyGlfwWindow(GLFWwindow* Window_Handle) noexcept;
+    /// @brief Destroys the GLFW window on the main thread without blocking
+    /// the calling thread.
+    static void DestroyGlfwWindow(GLFWwindow* Window_Handle,
+                                  window* Window,
+                                  std::weak_ptr<instance> Instance) noexcept;
 
     ////////////////////////////////////////////////////////////////////////////
     ///                           Private Variables                          ///
@@ -46,7 +61,9 @@ class window : public internal::uncopyable_unmovable // NOLINT
 
     instance_ptr gvwInstance;
 
-    std::unique_ptr<internal::terminator<GLFWwindow*>> glfwWindowDestroyer;
+    std::unique_ptr<
+        internal::terminator<GLFWwindow*, window*, std::weak_ptr<instance>>>
+        glfwWindowDestroyer;
 
     /// @brief The pointer to the underlying GLFW window object.
     GLFWwindow* windowHandle = nullptr;
@@ -57,15 +74,18 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Window surface.
     vk::UniqueSurfaceKHR surface;
 
+    /// @brief The framebuffer size when the window was created.
+    window_size creationFramebufferSize;
+
     /// @brief Logical device.
     device_ptr logicalDevice;
 
     /// @brief Graphics and presentation queue info.
     /// @remark The graphics queue is also used for transfer operations.
     uint32_t graphicsQueueIndex;
-    vk::Queue graphicsQueue;
+    queue_ptr graphicsQueue;
     uint32_t presentQueueIndex;
-    vk::Queue presentQueue;
+    queue_ptr presentQueue;
 
     render_pass_ptr renderPass;
 
@@ -89,7 +109,9 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Semaphores and fences.
     std::vector<vk::UniqueSemaphore> nextImageAvailableSemaphores;
     std::vector<vk::UniqueSemaphore> finishedRenderingSemaphores;
-    std::vector<vk::UniqueFence> inFlightFences;
+    /// @remark Windows drawn together by `instance::DrawFrames` share the
+    /// fence of their submission.
+    std::vector<std::shared_ptr<vk::UniqueFence>> inFlightFences;
 
     /// @brief Semaphore triggering configuration.
     std::vector<vk::PipelineStageFlags> waitStages;
@@ -98,6 +120,11 @@ class window : public internal::uncopyable_unmovable // NOLINT
     const uint32_t MAX_FRAMES_IN_FLIGHT = 1;
     uint32_t currentFrameIndex = 0;
 
+    /// @brief The command buffers and swapchain image of the frame recorded
+    /// last. The staging command buffer is submitted first.
+    std::array<vk::CommandBuffer, 2> frameCommandBuffers = {};
+    uint32_t frameImageIndex = 0;
+
     /// @brief The reset position of the window. This is the position of the
     /// window when it exits full screen, maximization, or iconification.
     coordinate<int> resetPosition = {};
@@ -109,72 +136,72 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Mutex for `resetPosition` and `resetSize`.
     std::mutex resetMutex;
 
-    /// @todo Figure out how to make these private.
-  public:
-    // NOLINTBEGIN
-    /// @brief Key events.
-    std::vector<window_key_event> keyEvents;
-    std::mutex keyEventsMutex;
+    /// @brief Event buffers filled from the event ring when events are read.
+    window_events events;
 
-    /// @brief Character events.
-    std::vector<window_character_event> characterEvents;
-    std::mutex characterEventsMutex;
+    /// @brief Coalescing policies applied when events are moved from the event
+    /// ring to the event buffers.
+    window_event_coalescing_info eventCoalescing;
 
-    /// @brief Cursor position events.
-    std::vector<window_cursor_position_event> cursorPositionEvents;
-    std::mutex cursorPositionEventsMutex;
+    /// @brief The time of the oldest event read since the last frame was
+    /// presented. Guarded by `eventsMutex`.
+    std::optional<event_time> oldestUnpresentedEventTime;
 
-    /// @brief Cursor enter events.
-    std::vector<window_cursor_enter_event> cursorEnterEvents;
-    std::mutex cursorEnterEventsMutex;
+    /// @brief Guarded by `eventsMutex`.
+    window_input_latency inputLatency;
 
-    /// @brief Mouse button events.
-    std::vector<window_mouse_button_event> mouseButtonEvents;
-    std::mutex mouseButtonEventsMutex;
+    /// @brief The input state as updated by the GLFW callbacks. Guarded by the
+    /// GLFW mutex.
+    window_input_state pendingInputState;
 
-    /// @brief Scroll events.
-    std::vector<window_scroll_event> scrollEvents;
-    std::mutex scrollEventsMutex;
+    static constexpr size_t EVENT_TYPE_COUNT =
+        static_cast<size_t>(window_event_type::eRefresh) + 1;
 
-    /// @brief File drop events.
-    std::vector<window_file_drop_event> fileDropEvents;
-    std::mutex fileDropEventsMutex;
+    /// @brief The coalesced event of each type received since the last time
+    /// coalesced events were pushed to the event ring, indexed by event type.
+    /// Guarded by the GLFW mutex.
+    std::array<std::optional<window_event>, EVENT_TYPE_COUNT> coalescedEvents;
 
-    /// @brief The number of close events.
-    size_t closeEvents = 0;
-    std::mutex closeEventsMutex;
+    /// @brief Whether the window is registered to be finished once the
+    /// current call to poll events returns. Guarded by the GLFW mutex.
+    bool awaitingPollEnd = false;
 
-    /// @brief Size events.
-    std::vector<window_size_event> sizeEvents;
-    std::mutex sizeEventsMutex;
+    /// @brief The input state published after each call to poll events. Read
+    /// without locking.
+    internal::seqlock<window_input_state> inputState;
 
-    /// @brief Framebuffer size events.
-    std::vector<window_framebuffer_size_event> framebufferSizeEvents;
-    std::mutex framebufferSizeEventsMutex;
+    /// @brief Whether the key, mouse button, and cursor position callbacks
+    /// keep `pendingInputState` up to date. If not, input queries call GLFW.
+    std::atomic<bool> keyStateTracked = false;
+    std::atomic<bool> mouseButtonStateTracked = false;
+    std::atomic<bool> cursorPositionTracked = false;
 
-    /// @brief Content scale events.
-    std::vector<window_content_scale_event> contentScaleEvents;
-    std::mutex contentScaleEventsMutex;
+    /// @brief Serializes the threads reading events, since the event ring only
+    /// supports a single consumer. Never locked by the GLFW callbacks.
+    std::mutex eventsMutex;
 
-    /// @brief Position events.
-    std::vector<window_position_event> positionEvents;
-    std::mutex positionEventsMutex;
+    /// @todo Figure out how to make these private.
+  public:
+    // NOLINTBEGIN
+    static constexpr size_t EVENT_RING_CAPACITY = 1024;
 
-    /// @brief Iconify events.
-    std::vector<window_iconify_event> iconifyEvents;
-    std::mutex iconifyEventsMutex;
+    /// @brief Slots of the event ring that only discrete events such as key
+    /// and mouse button events may fill, so that a backlog of continuous
+    /// events such as cursor motion cannot cause discrete events to be lost.
+    static constexpr size_t DISCRETE_EVENT_RESERVE = 256;
 
-    /// @brief Maximize events.
-    std::vector<window_maximize_event> maximizeEvents;
-    std::mutex maximizeEventsMutex;
+    /// @brief Events written by the GLFW callbacks on the thread that polls
+    /// events.
+    internal::spsc_ring<window_event, EVENT_RING_CAPACITY> eventRing;
 
-    /// @brief Focus events.
-    std::vector<window_focus_event> focusEvents;
-    std::mutex focusEventsMutex;
+    /// @brief The number of events discarded because the event ring was full.
+    std::atomic<size_t> droppedEventCount = 0;
 
-    /// @brief The number of refresh events.
-    size_t refreshEvents = 0;
-    std::mutex refreshEventsMutex;
+    /// @brief Appends an event to the event ring without locking and applies
+    /// it to the pending input state. Events with a coalescing policy are
+    /// merged and pushed once events have been polled. Called by the GLFW
+    /// callbacks.
+    void PushEvent(const window_event& Event) noexcept;
 
     // NOLINTEND
   private:
@@ -185,12 +212,90 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Sets the GLFW window user pointer.
     void SetUserPointer(void* Pointer);
 
+    /// @brief Returns whether events of a type describe a continuously
+    /// changing value, such as the cursor position, rather than a discrete
+    /// occurrence, such as a key press.
+    [[nodiscard]] static bool IsContinuousEvent(window_event_type Type);
+
+    /// @brief Applies a key, mouse button, or cursor position event to the
+    /// pending input state.
+    /// @warning The GLFW mutex must be locked.
+    void UpdateInputState(const window_event& Event);
+
+    /// @brief Makes the pending input state visible to `GetInputState`.
+    /// @warning The GLFW mutex must be locked.
+    void PublishInputState();
+
+    /// @brief Returns the coalescing policy of an event type. Events of types
+    /// without a policy are always kept.
+    [[nodiscard]] window_event_coalescing GetEventCoalescing(
+        window_event_type Type) const;
+
+    /// @brief Pushes the coalesced events to the event ring. Events that do
+    /// not fit are kept and pushed later.
+    /// @warning The GLFW mutex must be locked.
+    void PushCoalescedEvents();
+
+    /// @brief Registers the window to be finished once the current call to
+    /// poll events returns.
+    /// @warning The GLFW mutex must be locked.
+    void AwaitPollEnd();
+
+    /// @brief Pushes the coalesced events and publishes the input state.
+    /// @warning The GLFW mutex must be locked.
+    void FinishPoll();
+
+    /// @brief Moves every event in the event ring to the event buffers.
+    /// @warning The events mutex must be locked.
+    void DrainEventRing();
+
+    /// @brief Stores an event in an event buffer according to a coalescing
+    /// policy.
+    template<typename Event_Type>
+    static void StoreEvent(std::vector<Event_Type>& Events,
+                           std::vector<event_time>& Event_Times,
+                           const Event_Type& Event,
+                           event_time Event_Time,
+                           window_event_coalescing Coalescing);
+
+    /// @brief Creates the device, render pass, swapchain, pipeline, buffers,
+    /// and synchronization objects of the window. Static vertices are uploaded
+    /// with `Upload_Batch` unless the window info specifies a batch. If
+    /// neither is given they are uploaded immediately.
+    /// @remark Makes no GLFW calls, so it may be called from any thread once
+    /// the window and its surface exist.
+    void CreateVulkanObjects(const window_info& Window_Info,
+                             window* Parent_Window,
+                             const upload_batch_ptr& Upload_Batch);
+
     /// @brief Creates the swapchain.
     void CreateSwapchain();
 
+    /// @brief Creates the swapchain for a framebuffer of a specific size.
+    void CreateSwapchain(const window_size& Framebuffer_Size);
+
     /// @brief Creates the graphics pipeline.
     void CreatePipeline(const pipeline_dynamic_states& Dynamic_States);
 
+    /// @brief Waits until the previous frame of this window is done
+    /// rendering.
+    void WaitForFrame();
+
+    /// @brief Acquires the next swapchain image. Returns std::nullopt and
+    /// recreates the swapchain if it is out of date.
+    [[nodiscard]] std::optional<uint32_t> AcquireFrameImage();
+
+    /// @brief Copies vertices to the staging buffer and records the commands
+    /// that draw them to a swapchain image.
+    void RecordFrame(uint32_t Image_Index, const std::vector<xy_rgb>& Vertices);
+
+    /// @brief Returns the submit info of the frame recorded last.
+    [[nodiscard]] vk::SubmitInfo GetFrameSubmitInfo() const;
+
+    /// @brief Recreates the swapchain if presentation reported that it is out
+    /// of date, then advances to the next frame.
+    void EndFrame(vk::Result Present_Result);
+
   public:
     /// @brief Draws a frame.
     /// @todo This function does a lot of stuff that should be manually managed
@@ -211,11 +316,11 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Returns the value of an input mode of the window.
     [[nodiscard]] int GetInputMode(int Mode);
 
-    /// @brief Sets GLFW event callbacks. Passing no arguments sets all default
-    /// event callbacks, which populate the event buffers.
+    /// @brief Sets the GLFW event callbacks of a GLFW window.
     /// @warning This function is NOT thread safe.
-    void SetEventCallbacksNoMutex(
-        const window_event_callbacks& Event_Callbacks) const;
+    static void SetEventCallbacksNoMutex(
+        GLFWwindow* Window_Handle,
+        const window_event_callbacks& Event_Callbacks);
 
     /// @brief Returns the size of the content area of the window in screen
     /// coordinates.
@@ -371,10 +476,32 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Clears all event buffers.
     void ClearEvents() noexcept;
 
+    /// @brief Moves every buffered event into `Events` by swapping buffers.
+    /// Events previously held by `Events` are discarded, but the memory of its
+    /// buffers is kept and reused to receive later events. Reading and clearing
+    /// happen under a single lock so no events are lost in between.
+    void DrainEvents(window_events& Events) noexcept;
+
+    /// @brief Returns the number of events discarded because they were
+    /// received faster than they were read.
+    [[nodiscard]] size_t GetDroppedEventCount() const noexcept;
+
+    /// @brief Returns the delay between receiving input events and presenting
+    /// the first frame drawn after the events were read.
+    [[nodiscard]] window_input_latency GetInputLatency();
+
+    void ResetInputLatency();
+
+    /// @brief Returns the key, mouse button, and cursor state published the
+    /// last time events were polled. Never locks.
+    /// @remark Only the parts of the state whose events are appended to the
+    /// event buffers are kept up to date.
+    [[nodiscard]] window_input_state GetInputState() const noexcept;
+
     /// @brief Returns the state of a key.
     [[nodiscard]] window_key_action GetKeyState(window_key Key);
 
-    /// @todo Write functions for getting the mouse button states.
+    [[nodiscard]] bool IsMouseButtonPressed(int Button);
 
     [[nodiscard]] bool IsKeyPressed(window_key Key);
     [[nodiscard]] bool IsKeyReleased(window_key Key);
@@ -0,0 +1,129 @@
+// Standard includes
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+const uint32_t ALIGNMENT = 64;
+
+struct packed_file
+{
+    std::string name;
+    std::string contents;
+};
+
+const std::vector<packed_file> PACKED_FILES = {
+    { "shaders/triangle.vert.spv", "vertex shader code" },
+    { "images/empty.png", "" },
+    { "atlas.json", "{ \"pages\": 1 }" },
+};
+
+std::filesystem::path GetTestDirectory()
+{
+    return std::filesystem::temp_directory_path() / "gvw_archive_test";
+}
+
+/// @brief Writes each packed file to the test directory.
+gvw::archive_write_info WriteTestFiles()
+{
+    std::filesystem::create_directories(GetTestDirectory());
+    gvw::archive_write_info archiveWriteInfo = { .alignment = ALIGNMENT };
+    for (size_t i = 0; i < PACKED_FILES.size(); ++i) {
+        std::filesystem::path path =
+            GetTestDirectory() / ("file_" + std::to_string(i));
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << PACKED_FILES[i].contents;
+        file.close();
+        test::Assert(!file.fail(), "Failed to write a test file.");
+        archiveWriteInfo.files.push_back(
+            { .name = PACKED_FILES[i].name, .path = path.string() });
+    }
+    return archiveWriteInfo;
+}
+
+void TestRoundTrip()
+{
+    std::string archivePath = (GetTestDirectory() / "round_trip.gvwa").string();
+    test::Assert(gvw::WriteArchive(archivePath.c_str(), WriteTestFiles()),
+                 "Failed to write an archive.");
+
+    gvw::archive_ptr archive = gvw::OpenArchive(archivePath.c_str());
+    test::Assert(archive != nullptr, "Failed to open an archive.");
+
+    std::vector<std::string> names = archive->GetNames();
+    test::Assert(names.size() == PACKED_FILES.size() &&
+                     std::is_sorted(names.begin(), names.end()),
+                 "Archive names are missing or unsorted.");
+
+    for (const auto& packedFile : PACKED_FILES) {
+        gvw::file_view_ptr view = archive->Find(packedFile.name.c_str());
+        test::Assert(view != nullptr,
+                     "Archive is missing \"" + packedFile.name + "\".");
+        std::string contents(reinterpret_cast<const char*>( // NOLINT
+                                 view->GetData()),
+                             view->GetSize());
+        test::Assert(contents == packedFile.contents,
+                     "Archive changed \"" + packedFile.name + "\".");
+        test::Assert(
+            reinterpret_cast<uintptr_t>(view->GetData()) % ALIGNMENT == 0,
+            "\"" + packedFile.name + "\" is not aligned.");
+        test::Assert(archive->GetHash(packedFile.name.c_str()) ==
+                         gvw::internal::Fnv1a64(packedFile.contents.data(),
+                                                packedFile.contents.size()),
+                     "Archive hash of \"" + packedFile.name + "\" is wrong.");
+    }
+    test::Assert(archive->Find("missing") == nullptr,
+                 "Found a file that was not packed.");
+}
+
+void TestDuplicateNames()
+{
+    gvw::archive_write_info archiveWriteInfo = WriteTestFiles();
+    archiveWriteInfo.files.push_back(archiveWriteInfo.files.front());
+    std::string archivePath = (GetTestDirectory() / "duplicate.gvwa").string();
+    test::Assert(!gvw::WriteArchive(archivePath.c_str(), archiveWriteInfo),
+                 "Wrote an archive with a duplicate name.");
+}
+
+void TestMountedArchiveDoesNotShadowArchives()
+{
+    // Mount an archive containing a file with the same path as the archive.
+    std::string archivePath = (GetTestDirectory() / "mounted.gvwa").string();
+    gvw::archive_write_info archiveWriteInfo = WriteTestFiles();
+    archiveWriteInfo.files.push_back(
+        { .name = archivePath, .path = archiveWriteInfo.files.front().path });
+    test::Assert(gvw::WriteArchive(archivePath.c_str(), archiveWriteInfo),
+                 "Failed to write an archive.");
+    gvw::archive_ptr archive = gvw::OpenArchive(archivePath.c_str());
+    test::Assert(archive != nullptr, "Failed to open an archive.");
+    gvw::MountArchive(archive);
+
+    gvw::file_view_ptr mountedView = gvw::MapFile(archivePath.c_str());
+    bool mapsMountedFile =
+        mountedView != nullptr &&
+        mountedView->GetSize() == PACKED_FILES.front().contents.size();
+    gvw::archive_ptr reopenedArchive = gvw::OpenArchive(archivePath.c_str());
+    gvw::UnmountArchives();
+
+    test::Assert(mapsMountedFile, "MapFile ignored a mounted archive.");
+    test::Assert(reopenedArchive != nullptr,
+                 "OpenArchive read from a mounted archive.");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &=
+        test::ForThrow("Archive write and open round trip", TestRoundTrip);
+    passed &= test::ForThrow("Archive rejects duplicate names",
+                             TestDuplicateNames);
+    passed &= test::ForThrow("Mounted archives do not shadow archives",
+                             TestMountedArchiveDoesNotShadowArchives);
+    std::filesystem::remove_all(GetTestDirectory());
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// Standard includes
+#include <string>
+#include <vector>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+const int COLOR_COMPONENTS_PER_PIXEL = 4;
+
+/// @brief Creates an RGBA image of a single color by decoding a binary PPM.
+gvw::image_ptr CreateSolidImage(gvw::area<int> Size, uint8_t Red)
+{
+    std::string header = "P6\n" + std::to_string(Size.width) + " " +
+                         std::to_string(Size.height) + "\n255\n";
+    std::vector<uint8_t> data(header.begin(), header.end());
+    for (int pixel = 0; pixel < Size.width * Size.height; ++pixel) {
+        data.insert(data.end(), { Red, 0, 0 });
+    }
+    gvw::image_ptr image =
+        gvw::CreateImage(gvw::image_memory_info{ .data = std::move(data) });
+    test::Assert(image->GetSize().width == Size.width &&
+                     image->GetSize().height == Size.height,
+                 "Failed to decode a test image.");
+    return image;
+}
+
+bool Overlap(const gvw::atlas_region& Lhs,
+             const gvw::atlas_region& Rhs,
+             int Padding)
+{
+    return Lhs.page == Rhs.page &&
+           Lhs.position.x < Rhs.position.x + Rhs.size.width + Padding &&
+           Rhs.position.x < Lhs.position.x + Lhs.size.width + Padding &&
+           Lhs.position.y < Rhs.position.y + Rhs.size.height + Padding &&
+           Rhs.position.y < Lhs.position.y + Lhs.size.height + Padding;
+}
+
+void TestPacking()
+{
+    const gvw::atlas_info ATLAS_INFO = { .pageSize = { 64, 64 },
+                                         .padding = 1,
+                                         .maxPages = 2 };
+    gvw::atlas_ptr atlas = gvw::CreateAtlas(ATLAS_INFO);
+
+    std::vector<gvw::atlas_region> regions;
+    for (int i = 1; i <= 24; ++i) { // NOLINT
+        gvw::image_ptr image =
+            CreateSolidImage({ 4 + (i % 7), 4 + (i % 5) }, // NOLINT
+                             static_cast<uint8_t>(i));
+        std::optional<gvw::atlas_entry> entry = atlas->Insert(image);
+        test::Assert(entry.has_value(), "Failed to insert an image.");
+        std::optional<gvw::atlas_region> region = atlas->GetRegion(*entry);
+        test::Assert(region.has_value(), "Inserted image has no region.");
+        regions.push_back(*region);
+    }
+
+    for (size_t i = 0; i < regions.size(); ++i) {
+        const gvw::atlas_region& region = regions[i];
+        test::Assert(region.page < atlas->GetPageCount() &&
+                         region.position.x >= 0 && region.position.y >= 0 &&
+                         region.position.x + region.size.width <=
+                             ATLAS_INFO.pageSize.width &&
+                         region.position.y + region.size.height <=
+                             ATLAS_INFO.pageSize.height,
+                     "Region " + std::to_string(i) + " is out of bounds.");
+        for (size_t j = i + 1; j < regions.size(); ++j) {
+            test::Assert(!Overlap(region, regions[j], ATLAS_INFO.padding),
+                         "Regions " + std::to_string(i) + " and " +
+                             std::to_string(j) + " overlap.");
+        }
+
+        // Every pixel of an image holds its index in the red channel.
+        std::span<const uint8_t> page = atlas->GetPage(region.page);
+        size_t pixel = (static_cast<size_t>(region.position.y) *
+                        static_cast<size_t>(ATLAS_INFO.pageSize.width)) +
+                       static_cast<size_t>(region.position.x);
+        test::Assert(static_cast<size_t>(
+                         page[pixel * COLOR_COMPONENTS_PER_PIXEL]) == i + 1,
+                     "Region " + std::to_string(i) + " was not copied.");
+    }
+}
+
+void TestFullAtlas()
+{
+    gvw::atlas_ptr atlas = gvw::CreateAtlas(
+        { .pageSize = { 16, 16 }, .padding = 0, .maxPages = 1 }); // NOLINT
+
+    std::optional<gvw::atlas_entry> fullPage =
+        atlas->Insert(CreateSolidImage({ 16, 16 }, 1)); // NOLINT
+    test::Assert(fullPage.has_value(), "Failed to fill a page.");
+    test::Assert(!atlas->Insert(CreateSolidImage({ 1, 1 }, 2)).has_value(),
+                 "Inserted an image into a full atlas.");
+    test::Assert(atlas->GetPageCount() == 1, "Exceeded the page limit.");
+
+    // Space freed by removed images is reclaimed by repacking.
+    size_t revision = atlas->GetRevision();
+    atlas->Remove(*fullPage);
+    test::Assert(atlas->GetRevision() != revision,
+                 "Removing an image did not change the revision.");
+    std::optional<gvw::atlas_entry> reclaimed =
+        atlas->Insert(CreateSolidImage({ 8, 8 }, 3)); // NOLINT
+    test::Assert(reclaimed.has_value(), "Failed to reclaim removed space.");
+    test::Assert(!atlas->GetRegion(*fullPage).has_value(),
+                 "A removed image still has a region.");
+    test::Assert(atlas->GetRegion(*reclaimed).has_value(),
+                 "A reinserted image has no region.");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Atlas packs images without overlap", TestPacking);
+    passed &= test::ForThrow("Atlas page limit and repacking", TestFullAtlas);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+// Standard includes
+#include <chrono>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::window_event_coalescing;
+using gvw::window_event_type;
+
+gvw::window_event CreateEvent(window_event_type Type, gvw::event_time Time)
+{
+    gvw::window_event event{};
+    event.type = Type;
+    event.time = Time;
+    return event;
+}
+
+void TestKeepLast()
+{
+    gvw::window_cursor_position_event position = { 1.0, 2.0 };
+    gvw::internal::CoalesceValue(position,
+                                 gvw::window_cursor_position_event{ 5.0, 7.0 },
+                                 window_event_coalescing::eKeepLast);
+    test::Assert(position.x == 5.0 && position.y == 7.0,
+                 "The last cursor position was not kept.");
+}
+
+void TestAccumulate()
+{
+    gvw::window_scroll_event scroll = { 1.0, -2.0 };
+    gvw::internal::CoalesceValue(scroll,
+                                 gvw::window_scroll_event{ 0.5, -1.0 },
+                                 window_event_coalescing::eAccumulate);
+    gvw::internal::CoalesceValue(scroll,
+                                 gvw::window_scroll_event{ 0.5, -1.0 },
+                                 window_event_coalescing::eAccumulate);
+    test::Assert(scroll.x == 2.0 && scroll.y == -4.0,
+                 "Scroll offsets were not accumulated.");
+
+    // Sizes have no components to add, so the last size is kept.
+    gvw::window_size_event size = { 640, 480 };
+    gvw::internal::CoalesceValue(size,
+                                 gvw::window_size_event{ 800, 600 },
+                                 window_event_coalescing::eAccumulate);
+    test::Assert(size.width == 800 && size.height == 600,
+                 "Accumulating sizes did not keep the last size.");
+}
+
+void TestCoalesceEvent()
+{
+    gvw::event_time start = std::chrono::steady_clock::now();
+    gvw::event_time later = start + std::chrono::milliseconds(16);
+
+    gvw::window_event coalesced =
+        CreateEvent(window_event_type::eScroll, start);
+    coalesced.scroll = gvw::window_scroll_event{ 1.0, 1.0 };
+    gvw::window_event event = CreateEvent(window_event_type::eScroll, later);
+    event.scroll = gvw::window_scroll_event{ 2.0, 3.0 };
+    gvw::internal::CoalesceEvent(
+        coalesced, event, window_event_coalescing::eAccumulate);
+    test::Assert(coalesced.type == window_event_type::eScroll &&
+                     coalesced.scroll.x == 3.0 && coalesced.scroll.y == 4.0,
+                 "Scroll events were not accumulated.");
+    test::Assert(coalesced.time == later,
+                 "A coalesced event does not have the newest time.");
+
+    coalesced = CreateEvent(window_event_type::ePosition, start);
+    coalesced.position = gvw::window_position_event{ 10, 20 };
+    event = CreateEvent(window_event_type::ePosition, later);
+    event.position = gvw::window_position_event{ 30, 40 };
+    gvw::internal::CoalesceEvent(
+        coalesced, event, window_event_coalescing::eKeepLast);
+    test::Assert(coalesced.position.x == 30 && coalesced.position.y == 40 &&
+                     coalesced.time == later,
+                 "The last position event was not kept.");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Coalescing keeps the last value", TestKeepLast);
+    passed &= test::ForThrow("Coalescing accumulates values", TestAccumulate);
+    passed &= test::ForThrow("Coalescing merges window events",
+                             TestCoalesceEvent);
+    return passed ? 0 : 1;
+}
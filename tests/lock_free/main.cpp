@@ -0,0 +1,137 @@
+// Standard includes
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+const size_t RING_CAPACITY = 64;
+const uint64_t ELEMENT_COUNT = 100000;
+
+using ring = gvw::internal::spsc_ring<uint64_t, RING_CAPACITY>;
+
+void TestRingLimits()
+{
+    auto ringPtr = std::make_unique<ring>();
+
+    test::Assert(!ringPtr->TryPush(0, 0), "Pushed past a limit of zero.");
+    for (uint64_t i = 0; i < RING_CAPACITY; ++i) {
+        test::Assert(ringPtr->TryPush(i), "Failed to push into a ring.");
+    }
+    test::Assert(!ringPtr->TryPush(RING_CAPACITY), "Pushed into a full ring.");
+    test::Assert(ringPtr->Size() == RING_CAPACITY, "Wrong size of full ring.");
+
+    uint64_t element = 0;
+    test::Assert(ringPtr->TryPop(element) && element == 0,
+                 "Popped the wrong element from a full ring.");
+    test::Assert(!ringPtr->TryPush(RING_CAPACITY, RING_CAPACITY - 1),
+                 "Pushed into a reserved slot.");
+    test::Assert(ringPtr->TryPush(RING_CAPACITY),
+                 "Failed to push into a freed slot.");
+
+    for (uint64_t i = 1; i <= RING_CAPACITY; ++i) {
+        test::Assert(ringPtr->TryPop(element) && element == i,
+                     "Popped elements out of order.");
+    }
+    test::Assert(!ringPtr->TryPop(element), "Popped from an empty ring.");
+}
+
+void TestRingConcurrent()
+{
+    auto ringPtr = std::make_unique<ring>();
+    std::atomic<bool> producerSawFullRing = false;
+
+    std::thread producer([&]() {
+        for (uint64_t i = 0; i < ELEMENT_COUNT; ++i) {
+            while (!ringPtr->TryPush(i)) {
+                producerSawFullRing.store(true, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Let the producer fill the ring before consuming anything.
+    while (!producerSawFullRing.load(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+    }
+
+    bool inOrder = true;
+    for (uint64_t expected = 0; expected < ELEMENT_COUNT; ++expected) {
+        uint64_t element = 0;
+        while (!ringPtr->TryPop(element)) {
+            std::this_thread::yield();
+        }
+        inOrder = inOrder && element == expected;
+    }
+    producer.join();
+
+    test::Assert(inOrder, "Elements were popped out of order.");
+    test::Assert(ringPtr->Size() == 0, "The ring is not empty.");
+}
+
+struct snapshot
+{
+    uint64_t first;
+    uint64_t second;
+    uint64_t third;
+};
+
+void TestSeqlockConcurrent()
+{
+    const size_t READER_COUNT = 2;
+    const uint64_t STORE_COUNT = 100000;
+
+    gvw::internal::seqlock<snapshot> value;
+    value.Store({ 0, 0, 0 });
+    std::atomic<bool> writing = true;
+
+    std::vector<std::thread> readers;
+    std::vector<char> readersPassed(READER_COUNT, 1);
+    for (size_t reader = 0; reader < READER_COUNT; ++reader) {
+        readers.emplace_back([&, reader]() {
+            uint64_t previous = 0;
+            while (writing.load(std::memory_order_relaxed)) {
+                snapshot loaded = value.Load();
+                if (loaded.first != loaded.second ||
+                    loaded.first != loaded.third || loaded.first < previous) {
+                    readersPassed[reader] = 0;
+                    return;
+                }
+                previous = loaded.first;
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= STORE_COUNT; ++i) {
+        value.Store({ i, i, i });
+        if (i % RING_CAPACITY == 0) {
+            std::this_thread::yield();
+        }
+    }
+    writing.store(false, std::memory_order_relaxed);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    for (char readerPassed : readersPassed) {
+        test::Assert(readerPassed != 0, "A reader loaded a torn value.");
+    }
+    snapshot last = value.Load();
+    test::Assert(last.first == STORE_COUNT && last.third == STORE_COUNT,
+                 "The last stored value was not loaded.");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("spsc_ring limits", TestRingLimits);
+    passed &= test::ForThrow("spsc_ring concurrent producer and consumer",
+                             TestRingConcurrent);
+    passed &= test::ForThrow("seqlock concurrent writer and readers",
+                             TestSeqlockConcurrent);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "../../gvw/gvw.hpp"
+
+/// @brief Packs files into a GVW archive.
+/// @remark Usage: archive_packer [--alignment N] <output> <file>...
+/// Each file is stored under the path given on the command line unless it is
+/// written as name=path.
+int main(int argc, char** argv) // NOLINT
+{
+    gvw::SetErrorCallback(gvw::instance_error_callback_config::CERR);
+
+    std::vector<std::string> arguments(argv + 1, argv + argc); // NOLINT
+    gvw::archive_write_info archiveWriteInfo;
+
+    auto printUsage = []() {
+        std::cerr << "Usage: archive_packer [--alignment N] <output> "
+                     "[name=]<file>..."
+                  << std::endl;
+    };
+
+    if (arguments.size() >= 2 && arguments.at(0) == "--alignment") {
+        try {
+            unsigned long alignment = std::stoul(arguments.at(1));
+            if (alignment > std::numeric_limits<uint32_t>::max()) {
+                throw std::out_of_range("Alignment is too large.");
+            }
+            archiveWriteInfo.alignment = static_cast<uint32_t>(alignment);
+        } catch (const std::invalid_argument&) {
+            printUsage();
+            return 1;
+        } catch (const std::out_of_range&) {
+            printUsage();
+            return 1;
+        }
+        arguments.erase(arguments.begin(), arguments.begin() + 2);
+    }
+    if (arguments.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    for (size_t i = 1; i < arguments.size(); ++i) {
+        const std::string& argument = arguments.at(i);
+        size_t separator = argument.find('=');
+        if (separator == std::string::npos) {
+            archiveWriteInfo.files.push_back(
+                { .name = argument, .path = argument });
+        } else {
+            archiveWriteInfo.files.push_back(
+                { .name = argument.substr(0, separator),
+                  .path = argument.substr(separator + 1) });
+        }
+    }
+
+    if (!gvw::WriteArchive(arguments.at(0).c_str(), archiveWriteInfo)) {
+        return 1;
+    }
+    std::cout << "Packed " << archiveWriteInfo.files.size() << " files into \""
+              << arguments.at(0) << "\"." << std::endl;
+    return 0;
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <exception>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 
 // Local includes
 #include "../ansiec/ansiec.hpp"
@@ -49,4 +51,13 @@ bool ForThrow(const char* Name, Func&& Function, Args&&... Arguments)
     return true;
 }
 
+/// @brief Throws a std::runtime_error with a message if a condition is false.
+/// Intended for use within `ForThrow`.
+inline void Assert(bool Condition, const std::string& Message)
+{
+    if (!Condition) {
+        throw std::runtime_error(Message);
+    }
+}
+
 } // namespace test
\ No newline at end of file